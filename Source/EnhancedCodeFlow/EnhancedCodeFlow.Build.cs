@@ -18,7 +18,8 @@ public class EnhancedCodeFlow : ModuleRules
 			{
 				"Core",
 				"CoreUObject",
-				"Engine"
+				"Engine",
+				"DeveloperSettings"
 			}
 		);
 
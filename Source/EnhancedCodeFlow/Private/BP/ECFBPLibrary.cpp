@@ -20,6 +20,26 @@ void UECFBPLibrary::ECFGetPause(const UObject* WorldContextObject, bool& bIsPaus
 	bIsPaused = FFlow::GetPause(WorldContextObject);
 }
 
+void UECFBPLibrary::ECFSetClockPaused(const UObject* WorldContextObject, FName Clock, bool bPaused)
+{
+	FFlow::SetClockPaused(WorldContextObject, Clock, bPaused);
+}
+
+void UECFBPLibrary::ECFIsClockPaused(const UObject* WorldContextObject, FName Clock, bool& bIsPaused)
+{
+	bIsPaused = FFlow::IsClockPaused(WorldContextObject, Clock);
+}
+
+void UECFBPLibrary::ECFSetClockTimeScale(const UObject* WorldContextObject, FName Clock, float TimeScale)
+{
+	FFlow::SetClockTimeScale(WorldContextObject, Clock, TimeScale);
+}
+
+void UECFBPLibrary::ECFGetClockTimeScale(const UObject* WorldContextObject, FName Clock, float& TimeScale)
+{
+	TimeScale = FFlow::GetClockTimeScale(WorldContextObject, Clock);
+}
+
 void UECFBPLibrary::ECFIsActionRunning(bool& bIsRunning, const UObject* WorldContextObject, const FECFHandleBP& Handle)
 {
 	bIsRunning = FFlow::IsActionRunning(WorldContextObject, Handle.Handle);
@@ -74,7 +74,7 @@ void FECFCoroutineAwaiter_WaitUntil::await_suspend(FECFCoroutineHandle InCoroHan
 
 /*^^^ Run Async And Wait Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
-FECFCoroutineAwaiter_RunAsyncAndWait::FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority)
+FECFCoroutineAwaiter_RunAsyncAndWait::FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, FECFAsyncTaskFunc&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFAsyncPipe& InPipe)
 {
 	Owner = InOwner;
 	Settings = InSettings;
@@ -82,11 +82,12 @@ FECFCoroutineAwaiter_RunAsyncAndWait::FECFCoroutineAwaiter_RunAsyncAndWait(const
 	AsyncTaskFunction = MoveTemp(InAsyncTaskFunc);
 	TimeOut = InTimeOut;
 	ThreadPriority = InThreadPriority;
+	Pipe = InPipe;
 }
 
 void FECFCoroutineAwaiter_RunAsyncAndWait::await_suspend(FECFCoroutineHandle InCoroHandle)
 {
-	AddCoroutineAction<UECFRunAsyncAndWait>(Owner, InCoroHandle, Settings, MoveTemp(AsyncTaskFunction), TimeOut, ThreadPriority);
+	AddCoroutineAction<UECFRunAsyncAndWait>(Owner, InCoroHandle, Settings, MoveTemp(AsyncTaskFunction), TimeOut, ThreadPriority, Pipe);
 }
 
 /*^^^ Wait Load Objects Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
@@ -0,0 +1,65 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFAsyncPipeline.h"
+#include "ECFLogs.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+bool FECFAsyncPipeline::IsValid() const
+{
+	return (Stages.Num() > 0) && (bHasInvalidStages == false);
+}
+
+int32 FECFAsyncPipeline::Num() const
+{
+	return Stages.Num();
+}
+
+int32 FECFAsyncPipeline::AddStage(const TArray<int32>& Prerequisites, bool bWhenAny, FECFAsyncTaskFunc&& InFunc)
+{
+	if (InFunc.IsSet() == false)
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("ECF - async pipeline stage %d has no function set."), Stages.Num());
+#endif
+		bHasInvalidStages = true;
+		return INDEX_NONE;
+	}
+
+	// Duplicated prerequisites would be counted twice and the stage would never be launched.
+	TArray<int32> UniquePrerequisites;
+	for (int32 Prerequisite : Prerequisites)
+	{
+		if (Stages.IsValidIndex(Prerequisite) == false)
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - async pipeline stage %d has invalid prerequisite %d. Prerequisites must be added before the stage."), Stages.Num(), Prerequisite);
+#endif
+			bHasInvalidStages = true;
+			return INDEX_NONE;
+		}
+		UniquePrerequisites.AddUnique(Prerequisite);
+	}
+
+	if (bWhenAny && (UniquePrerequisites.Num() == 0))
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("ECF - async pipeline stage %d waits for any of no prerequisites."), Stages.Num());
+#endif
+		bHasInvalidStages = true;
+		return INDEX_NONE;
+	}
+
+	const int32 StageId = Stages.Num();
+	for (int32 Prerequisite : UniquePrerequisites)
+	{
+		Stages[Prerequisite].Dependents.Add(StageId);
+	}
+
+	FStage& NewStage = Stages.AddDefaulted_GetRef();
+	NewStage.Func = MoveTemp(InFunc);
+	NewStage.PrerequisitesNum = bWhenAny ? 1 : UniquePrerequisites.Num();
+	return StageId;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
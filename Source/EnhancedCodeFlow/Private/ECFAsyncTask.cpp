@@ -0,0 +1,505 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFAsyncTask.h"
+#include "ECFAsyncPipeline.h"
+#include "ECFLogs.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Containers/Queue.h"
+#include "Misc/ScopeLock.h"
+
+#if (ENGINE_MAJOR_VERSION == 5)
+#include "Tasks/Task.h"
+#else
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+#endif
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+#if (ENGINE_MAJOR_VERSION == 5)
+namespace ECFAsyncTask
+{
+	UE::Tasks::ETaskPriority GetTaskPriority(EECFAsyncPrio Priority)
+	{
+		switch (Priority)
+		{
+			case EECFAsyncPrio::HiPriority:
+				return UE::Tasks::ETaskPriority::BackgroundHigh;
+			case EECFAsyncPrio::LowPriority:
+				return UE::Tasks::ETaskPriority::BackgroundLow;
+			case EECFAsyncPrio::Foreground:
+				return UE::Tasks::ETaskPriority::High;
+			case EECFAsyncPrio::Normal:
+			default:
+				return UE::Tasks::ETaskPriority::BackgroundNormal;
+		}
+	}
+
+	template<typename FuncType>
+	void LaunchOnWorker(FuncType&& Work, EECFAsyncPrio Priority)
+	{
+		UE::Tasks::Launch(TEXT("ECF Async Task"), Forward<FuncType>(Work), GetTaskPriority(Priority));
+	}
+}
+#else
+namespace ECFAsyncTask
+{
+	// UE4 task graph has no low priority for background threads, so low priority tasks use the normal one.
+	ENamedThreads::Type GetThreadType(EECFAsyncPrio Priority)
+	{
+		switch (Priority)
+		{
+			case EECFAsyncPrio::HiPriority:
+				return ENamedThreads::AnyBackgroundHiPriTask;
+			case EECFAsyncPrio::Foreground:
+				return ENamedThreads::AnyHiPriThreadHiPriTask;
+			case EECFAsyncPrio::LowPriority:
+			case EECFAsyncPrio::Normal:
+			default:
+				return ENamedThreads::AnyBackgroundThreadNormalTask;
+		}
+	}
+
+	template<typename FuncType>
+	void LaunchOnWorker(FuncType&& Work, EECFAsyncPrio Priority)
+	{
+		AsyncTask(GetThreadType(Priority), Forward<FuncType>(Work));
+	}
+}
+#endif
+
+struct FECFAsyncTask::FPipelineState : public FState
+{
+	TArray<FECFAsyncPipeline::FStage> Stages;
+
+	// Number of prerequisites each stage still waits for. The stage is launched by the one that brings it to zero.
+	TUniquePtr<std::atomic<int32>[]> PendingPrerequisites;
+
+	// Number of stages that haven't ended yet. The task is done when it reaches zero.
+	std::atomic<int32> RemainingStages { 0 };
+
+	EECFAsyncPrio Priority = EECFAsyncPrio::Normal;
+};
+
+/**
+ * All queues are guarded by one lock. A slot is released and the next queued work is taken in the same critical section,
+ * so new work can't skip the queued one. Pipes keep their own queues of work and only their first work waits
+ * in the queue of its priority, so pipes launch at most one work at a time and in the order it has been added.
+ */
+class FECFAsyncTask::FExecutor
+{
+
+public:
+
+	static FExecutor& Get()
+	{
+		static FExecutor Executor;
+		return Executor;
+	}
+
+	// Launches the work on a worker thread if there is a free slot and nothing waits for it, otherwise queues it.
+	// Can be called from any thread.
+	void Launch(const TSharedRef<FState, ESPMode::ThreadSafe>& InState, TUniqueFunction<void()>&& InWork, EECFAsyncPrio InPriority, const FECFAsyncPipe& InPipe)
+	{
+		FWork NewWork;
+		NewWork.State = InState;
+		NewWork.Func = MoveTemp(InWork);
+		NewWork.Priority = InPriority;
+		NewWork.QueueTime = FPlatformTime::Seconds();
+
+		FDispatchedWork DispatchedWork;
+		{
+			FScopeLock Lock(&CriticalSection);
+			QueuedTasksNum++;
+			if (InPipe.IsNone())
+			{
+				FEntry NewEntry;
+				NewEntry.Work = MoveTemp(NewWork);
+				Queues[GetQueueIndex(InPriority)].Enqueue(MoveTemp(NewEntry));
+			}
+			else
+			{
+				TUniquePtr<FPipeQueue>& Pipe = Pipes.FindOrAdd(InPipe);
+				if (Pipe.IsValid() == false)
+				{
+					Pipe = MakeUnique<FPipeQueue>();
+					Pipe->Key = InPipe;
+				}
+				Pipe->Works.Enqueue(MoveTemp(NewWork));
+				SchedulePipe(*Pipe);
+			}
+			Dispatch(DispatchedWork, &InState.Get());
+		}
+		LaunchDispatched(DispatchedWork);
+	}
+
+	void SetMaxTasksInFlight(int32 InMaxTasksInFlight)
+	{
+		FDispatchedWork DispatchedWork;
+		{
+			FScopeLock Lock(&CriticalSection);
+			MaxTasksInFlight = FMath::Max(InMaxTasksInFlight, 0);
+			Dispatch(DispatchedWork);
+		}
+		LaunchDispatched(DispatchedWork);
+	}
+
+	FECFAsyncExecutorStats GetStats()
+	{
+		FScopeLock Lock(&CriticalSection);
+		FECFAsyncExecutorStats Stats;
+		Stats.QueuedTasksNum = QueuedTasksNum;
+		Stats.TasksInFlightNum = TasksInFlightNum;
+		Stats.AverageWaitTime = AverageWaitTime;
+		Stats.AverageRunTime = AverageRunTime;
+		return Stats;
+	}
+
+private:
+
+	struct FPipeQueue;
+
+	struct FWork
+	{
+		TSharedPtr<FState, ESPMode::ThreadSafe> State;
+		TUniqueFunction<void()> Func;
+		FPipeQueue* Pipe = nullptr;
+		EECFAsyncPrio Priority = EECFAsyncPrio::Normal;
+		double QueueTime = 0.0;
+
+		// Indicates if the action should be notified about the start of the work, because it has been waiting in the queue.
+		bool bNotifyStart = false;
+	};
+
+	// Works of one pipe, launched one after another.
+	struct FPipeQueue
+	{
+		FECFAsyncPipe Key;
+		TQueue<FWork> Works;
+
+		// Indicates if the first work of this pipe waits in the queue of its priority.
+		bool bIsScheduled = false;
+
+		// Indicates if the work of this pipe is running.
+		bool bIsRunning = false;
+	};
+
+	// Entry of the priority queue. It is either the work or the pipe which first work should be launched.
+	struct FEntry
+	{
+		FWork Work;
+		FPipeQueue* Pipe = nullptr;
+	};
+
+	struct FDispatchedWork
+	{
+		TArray<FWork, TInlineAllocator<4>> WorkToLaunch;
+		TArray<FWork, TInlineAllocator<4>> CanceledWork;
+	};
+
+	// Queues are emptied in the order of their indices.
+	static int32 GetQueueIndex(EECFAsyncPrio Priority)
+	{
+		switch (Priority)
+		{
+			case EECFAsyncPrio::Foreground:
+				return 0;
+			case EECFAsyncPrio::HiPriority:
+				return 1;
+			case EECFAsyncPrio::LowPriority:
+				return 3;
+			case EECFAsyncPrio::Normal:
+			default:
+				return 2;
+		}
+	}
+
+	// Puts the pipe into the queue of the priority of its first work, unless it is already there or its work is running. Locked only.
+	void SchedulePipe(FPipeQueue& Pipe)
+	{
+		if (Pipe.bIsScheduled || Pipe.bIsRunning)
+		{
+			return;
+		}
+
+		if (FWork* FirstWork = Pipe.Works.Peek())
+		{
+			Pipe.bIsScheduled = true;
+			FEntry PipeEntry;
+			PipeEntry.Pipe = &Pipe;
+			Queues[GetQueueIndex(FirstWork->Priority)].Enqueue(MoveTemp(PipeEntry));
+		}
+		else
+		{
+			// Pipes without any work are not needed anymore.
+			const FECFAsyncPipe Key = Pipe.Key;
+			Pipes.Remove(Key);
+		}
+	}
+
+	bool HasFreeSlot() const
+	{
+		return (MaxTasksInFlight <= 0) || (TasksInFlightNum < MaxTasksInFlight);
+	}
+
+	// Takes the queued work while there are free slots. The work of the launching state hasn't waited, so it isn't notified. Locked only.
+	void Dispatch(FDispatchedWork& OutDispatchedWork, const FState* LaunchingState = nullptr)
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		for (TQueue<FEntry>& Queue : Queues)
+		{
+			FEntry Entry;
+			while (HasFreeSlot() && Queue.Dequeue(Entry))
+			{
+				FWork Work;
+				if (Entry.Pipe)
+				{
+					FPipeQueue* Pipe = Entry.Pipe;
+					Pipe->bIsScheduled = false;
+					Pipe->Works.Dequeue(Work);
+					Work.Pipe = Pipe;
+				}
+				else
+				{
+					Work = MoveTemp(Entry.Work);
+				}
+				QueuedTasksNum--;
+
+				// Canceled work doesn't call the function, so it doesn't need a slot.
+				if (Work.State->CancellationToken.IsCanceled())
+				{
+					if (Work.Pipe)
+					{
+						SchedulePipe(*Work.Pipe);
+						Work.Pipe = nullptr;
+					}
+					OutDispatchedWork.CanceledWork.Add(MoveTemp(Work));
+					continue;
+				}
+
+				if (Work.Pipe)
+				{
+					Work.Pipe->bIsRunning = true;
+				}
+				TasksInFlightNum++;
+				AverageWaitTime = FMath::Lerp(AverageWaitTime, CurrentTime - Work.QueueTime, AverageFactor);
+				Work.bNotifyStart = (Work.State.Get() != LaunchingState);
+				OutDispatchedWork.WorkToLaunch.Add(MoveTemp(Work));
+			}
+		}
+	}
+
+	void LaunchDispatched(FDispatchedWork& DispatchedWork)
+	{
+		for (FWork& Work : DispatchedWork.CanceledWork)
+		{
+			Work.Func();
+		}
+
+		for (FWork& Work : DispatchedWork.WorkToLaunch)
+		{
+			// Let the action know the task has left the queue, so it can start counting its timeout.
+			if ((Work.State->bIsStarted.exchange(true, std::memory_order_acq_rel) == false) && Work.bNotifyStart)
+			{
+				Work.State->CompletionNotifier.Notify();
+			}
+
+			const EECFAsyncPrio Priority = Work.Priority;
+			ECFAsyncTask::LaunchOnWorker([this, Work = MoveTemp(Work)]() mutable
+			{
+				const double StartTime = FPlatformTime::Seconds();
+				Work.Func();
+				const double RunTime = FPlatformTime::Seconds() - StartTime;
+
+				// Release the work before the next one is launched, so it doesn't hold the state longer than needed.
+				FPipeQueue* Pipe = Work.Pipe;
+				Work = FWork();
+				OnWorkEnded(Pipe, RunTime);
+			}, Priority);
+		}
+	}
+
+	void OnWorkEnded(FPipeQueue* Pipe, double RunTime)
+	{
+		FDispatchedWork DispatchedWork;
+		{
+			FScopeLock Lock(&CriticalSection);
+			TasksInFlightNum--;
+			AverageRunTime = FMath::Lerp(AverageRunTime, RunTime, AverageFactor);
+			if (Pipe)
+			{
+				Pipe->bIsRunning = false;
+				SchedulePipe(*Pipe);
+			}
+			Dispatch(DispatchedWork);
+		}
+		LaunchDispatched(DispatchedWork);
+	}
+
+	// Weight of the newest sample in the average times.
+	static constexpr double AverageFactor = 0.1;
+
+	FCriticalSection CriticalSection;
+	TQueue<FEntry> Queues[4];
+	TMap<FECFAsyncPipe, TUniquePtr<FPipeQueue>> Pipes;
+	int32 MaxTasksInFlight = 0;
+	int32 TasksInFlightNum = 0;
+	int32 QueuedTasksNum = 0;
+	double AverageWaitTime = 0.0;
+	double AverageRunTime = 0.0;
+};
+
+bool FECFAsyncTask::Launch(FECFAsyncTaskFunc&& InFunc, EECFAsyncPrio InPriority, const FECFAsyncPipe& InPipe/* = {}*/, const FECFCompletionNotifier& InCompletionNotifier/* = {}*/)
+{
+	Reset();
+
+	if (InFunc.IsSet() == false)
+	{
+		return false;
+	}
+
+	TSharedRef<FFuncState, ESPMode::ThreadSafe> NewState = MakeShared<FFuncState, ESPMode::ThreadSafe>();
+	NewState->Func = MoveTemp(InFunc);
+	LaunchState(NewState, InPriority, InPipe, InCompletionNotifier);
+	return true;
+}
+
+bool FECFAsyncTask::Launch(FECFAsyncPipeline&& InPipeline, EECFAsyncPrio InPriority, const FECFCompletionNotifier& InCompletionNotifier/* = {}*/)
+{
+	Reset();
+
+	if (InPipeline.IsValid() == false)
+	{
+		return false;
+	}
+
+	TSharedRef<FPipelineState, ESPMode::ThreadSafe> NewState = MakeShared<FPipelineState, ESPMode::ThreadSafe>();
+	NewState->Stages = MoveTemp(InPipeline.Stages);
+	NewState->PendingPrerequisites = MakeUnique<std::atomic<int32>[]>(NewState->Stages.Num());
+	for (int32 StageId = 0; StageId < NewState->Stages.Num(); StageId++)
+	{
+		NewState->PendingPrerequisites[StageId].store(NewState->Stages[StageId].PrerequisitesNum, std::memory_order_relaxed);
+	}
+	NewState->RemainingStages.store(NewState->Stages.Num(), std::memory_order_relaxed);
+	NewState->Priority = InPriority;
+	NewState->CompletionNotifier = InCompletionNotifier;
+	State = NewState;
+
+	// Collect the first stages before launching any, because launched stages can already modify the counters.
+	TArray<int32, TInlineAllocator<8>> FirstStages;
+	for (int32 StageId = 0; StageId < NewState->Stages.Num(); StageId++)
+	{
+		if (NewState->Stages[StageId].PrerequisitesNum == 0)
+		{
+			FirstStages.Add(StageId);
+		}
+	}
+	for (int32 StageId : FirstStages)
+	{
+		LaunchStage(NewState, StageId);
+	}
+	return true;
+}
+
+void FECFAsyncTask::LaunchState(const TSharedRef<FSingleState, ESPMode::ThreadSafe>& NewState, EECFAsyncPrio InPriority, const FECFAsyncPipe& InPipe, const FECFCompletionNotifier& InCompletionNotifier)
+{
+	NewState->CompletionNotifier = InCompletionNotifier;
+	State = NewState;
+	FExecutor::Get().Launch(NewState, [NewState]() { Run(NewState); }, InPriority, InPipe);
+}
+
+void FECFAsyncTask::Cancel()
+{
+	if (State.IsValid())
+	{
+		State->CancellationToken.Cancel();
+	}
+}
+
+void FECFAsyncTask::Reset()
+{
+	if (State.IsValid())
+	{
+		State->CancellationToken.Cancel();
+		State->ReleaseCallback();
+		State.Reset();
+	}
+}
+
+bool FECFAsyncTask::IsDone() const
+{
+	return State.IsValid() && State->bIsDone.load(std::memory_order_acquire);
+}
+
+bool FECFAsyncTask::IsStarted() const
+{
+	return State.IsValid() && State->bIsStarted.load(std::memory_order_acquire);
+}
+
+void FECFAsyncTask::Complete(bool bTimedOut, bool bStopped)
+{
+	if (State.IsValid())
+	{
+		State->Complete(bTimedOut, bStopped);
+	}
+}
+
+void FECFAsyncTask::SetMaxTasksInFlight(int32 InMaxTasksInFlight)
+{
+	check(IsInGameThread());
+	FExecutor::Get().SetMaxTasksInFlight(InMaxTasksInFlight);
+}
+
+FECFAsyncExecutorStats FECFAsyncTask::GetExecutorStats()
+{
+	return FExecutor::Get().GetStats();
+}
+
+void FECFAsyncTask::Run(const TSharedRef<FSingleState, ESPMode::ThreadSafe>& InState)
+{
+	// Don't even start the function if nobody waits for it anymore.
+	if (InState->CancellationToken.IsCanceled() == false)
+	{
+		InState->Execute();
+	}
+	InState->Finish();
+}
+
+void FECFAsyncTask::LaunchStage(const TSharedRef<FPipelineState, ESPMode::ThreadSafe>& InState, int32 StageId)
+{
+	FExecutor::Get().Launch(InState, [InState, StageId]() { RunStage(InState, StageId); }, InState->Priority, FECFAsyncPipe());
+}
+
+void FECFAsyncTask::RunStage(const TSharedRef<FPipelineState, ESPMode::ThreadSafe>& InState, int32 StageId)
+{
+	FECFAsyncPipeline::FStage& Stage = InState->Stages[StageId];
+	const bool bIsCanceled = InState->CancellationToken.IsCanceled();
+	if (bIsCanceled == false)
+	{
+		Stage.Func(InState->CancellationToken);
+	}
+
+	for (int32 Dependent : Stage.Dependents)
+	{
+		// WhenAny stages wait only for one prerequisite, so the next ones bring the counter below zero and are ignored.
+		if (InState->PendingPrerequisites[Dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			// Canceled stages are only counted, so there is no need to launch them on workers.
+			if (bIsCanceled)
+			{
+				RunStage(InState, Dependent);
+			}
+			else
+			{
+				LaunchStage(InState, Dependent);
+			}
+		}
+	}
+
+	if (InState->RemainingStages.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		InState->Finish();
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,12 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFClocks.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+const FName FECFClocks::Gameplay = TEXT("Gameplay");
+const FName FECFClocks::UI = TEXT("UI");
+const FName FECFClocks::Cinematic = TEXT("Cinematic");
+const FName FECFClocks::Real = TEXT("Real");
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,133 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFCommandQueue.h"
+#include "ECFLogs.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+FECFCommandQueue::FECFCommandQueue()
+{
+	for (uint32 Index = 0; Index < MaxReservedHandles; Index++)
+	{
+		ReservedHandles[Index].store(0, std::memory_order_relaxed);
+	}
+	ReservedReadIndex.store(0, std::memory_order_relaxed);
+	ReservedWriteIndex.store(0, std::memory_order_relaxed);
+	bIsClosed.store(false, std::memory_order_relaxed);
+}
+
+FECFHandle FECFCommandQueue::StartAction(TUniqueFunction<void()>&& StartFunc)
+{
+	if (bIsClosed.load(std::memory_order_acquire) || (StartFunc == nullptr))
+	{
+		return FECFHandle();
+	}
+
+	FCommand Command;
+	Command.Type = ECommandType::StartAction;
+	Command.StartFunc = MoveTemp(StartFunc);
+	if (TakeReservedHandle(Command.Handle) == false)
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Warning, TEXT("ECF - there are no reserved handles left. The action will be started without a handle."));
+#endif
+	}
+
+	// Copy the handle before the command is moved to the queue.
+	const FECFHandle ReservedHandle = Command.Handle;
+	Enqueue(MoveTemp(Command));
+	return ReservedHandle;
+}
+
+void FECFCommandQueue::StopAction(const FECFHandle& Handle, bool bComplete/* = false*/)
+{
+	FCommand Command;
+	Command.Type = ECommandType::StopAction;
+	Command.Handle = Handle;
+	Command.bComplete = bComplete;
+	Enqueue(MoveTemp(Command));
+}
+
+void FECFCommandQueue::PauseAction(const FECFHandle& Handle)
+{
+	FCommand Command;
+	Command.Type = ECommandType::PauseAction;
+	Command.Handle = Handle;
+	Enqueue(MoveTemp(Command));
+}
+
+void FECFCommandQueue::ResumeAction(const FECFHandle& Handle)
+{
+	FCommand Command;
+	Command.Type = ECommandType::ResumeAction;
+	Command.Handle = Handle;
+	Enqueue(MoveTemp(Command));
+}
+
+void FECFCommandQueue::Enqueue(FCommand&& Command)
+{
+	if (bIsClosed.load(std::memory_order_acquire))
+	{
+		return;
+	}
+	Commands.Enqueue(MoveTemp(Command));
+}
+
+bool FECFCommandQueue::Dequeue(FCommand& OutCommand)
+{
+	check(IsInGameThread());
+	return Commands.Dequeue(OutCommand);
+}
+
+bool FECFCommandQueue::IsEmpty() const
+{
+	check(IsInGameThread());
+	return Commands.IsEmpty();
+}
+
+bool FECFCommandQueue::TakeReservedHandle(FECFHandle& OutHandle)
+{
+	uint64 ReadIndex = ReservedReadIndex.load(std::memory_order_acquire);
+	while (ReadIndex < ReservedWriteIndex.load(std::memory_order_acquire))
+	{
+		// Read the handle before claiming it. The Game Thread never overwrites handles that haven't been claimed yet,
+		// so if the claim succeeds the handle is still the right one. Otherwise try the next one.
+		const uint64 RawHandle = ReservedHandles[ReadIndex % MaxReservedHandles].load(std::memory_order_relaxed);
+		if (ReservedReadIndex.compare_exchange_weak(ReadIndex, ReadIndex + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			OutHandle = FECFHandle(static_cast<uint32>(RawHandle & 0xFFFFFFFF), static_cast<uint32>(RawHandle >> 32));
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FECFCommandQueue::AddReservedHandle(const FECFHandle& Handle)
+{
+	check(IsInGameThread());
+
+	const uint64 WriteIndex = ReservedWriteIndex.load(std::memory_order_relaxed);
+	if ((WriteIndex - ReservedReadIndex.load(std::memory_order_acquire)) >= MaxReservedHandles)
+	{
+		return false;
+	}
+
+	const uint64 RawHandle = (static_cast<uint64>(Handle.GetGeneration()) << 32) | static_cast<uint64>(Handle.GetSlotIndex());
+	ReservedHandles[WriteIndex % MaxReservedHandles].store(RawHandle, std::memory_order_relaxed);
+	ReservedWriteIndex.store(WriteIndex + 1, std::memory_order_release);
+	return true;
+}
+
+uint32 FECFCommandQueue::GetReservedHandlesNum() const
+{
+	const uint64 WriteIndex = ReservedWriteIndex.load(std::memory_order_acquire);
+	const uint64 ReadIndex = ReservedReadIndex.load(std::memory_order_acquire);
+	return (WriteIndex > ReadIndex) ? static_cast<uint32>(WriteIndex - ReadIndex) : 0;
+}
+
+void FECFCommandQueue::Close()
+{
+	bIsClosed.store(true, std::memory_order_release);
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
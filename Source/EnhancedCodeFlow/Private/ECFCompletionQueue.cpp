@@ -0,0 +1,27 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFCompletionQueue.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+void FECFCompletionQueue::Push(const FECFHandle& Handle)
+{
+	FCompletion Completion;
+	Completion.Handle = Handle;
+	Completion.PushTime = FPlatformTime::Seconds();
+	Completions.Enqueue(MoveTemp(Completion));
+}
+
+bool FECFCompletionQueue::Pop(FCompletion& OutCompletion)
+{
+	check(IsInGameThread());
+	return Completions.Dequeue(OutCompletion);
+}
+
+bool FECFCompletionQueue::IsEmpty() const
+{
+	check(IsInGameThread());
+	return Completions.IsEmpty();
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
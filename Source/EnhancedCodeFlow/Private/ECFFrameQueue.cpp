@@ -0,0 +1,30 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFFrameQueue.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+void FECFFrameQueue::Schedule(const FECFHandle& Handle, uint32 SleepId, uint64 DueFrame)
+{
+	FEntry NewEntry;
+	NewEntry.Handle = Handle;
+	NewEntry.SleepId = SleepId;
+	NewEntry.DueTick = DueFrame;
+	Entries.HeapPush(MoveTemp(NewEntry), FDueFramePredicate());
+}
+
+void FECFFrameQueue::Advance(uint64 NewFrame, TArray<FEntry>& OutDueEntries)
+{
+	while ((Entries.Num() > 0) && (Entries.HeapTop().DueTick <= NewFrame))
+	{
+		OutDueEntries.Add(Entries.HeapTop());
+		Entries.HeapPopDiscard(FDueFramePredicate());
+	}
+}
+
+void FECFFrameQueue::Reset()
+{
+	Entries.Empty();
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,62 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFHandleGenerations.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+FECFHandleGenerations::FECFHandleGenerations()
+{
+	for (uint32 ChunkIndex = 0; ChunkIndex < MaxChunks; ChunkIndex++)
+	{
+		Chunks[ChunkIndex].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FECFHandleGenerations::~FECFHandleGenerations()
+{
+	for (uint32 ChunkIndex = 0; ChunkIndex < MaxChunks; ChunkIndex++)
+	{
+		delete[] Chunks[ChunkIndex].load(std::memory_order_relaxed);
+	}
+}
+
+bool FECFHandleGenerations::IsActionRunning(const FECFHandle& Handle) const
+{
+	return Handle.IsValid() && (GetGeneration(Handle.GetSlotIndex()) == Handle.GetGeneration());
+}
+
+uint32 FECFHandleGenerations::GetGeneration(uint32 SlotIndex) const
+{
+	if (SlotIndex >= MaxSlots)
+	{
+		return 0;
+	}
+
+	if (const std::atomic<uint32>* Chunk = Chunks[SlotIndex / ChunkSize].load(std::memory_order_acquire))
+	{
+		return Chunk[SlotIndex % ChunkSize].load(std::memory_order_acquire);
+	}
+
+	return 0;
+}
+
+void FECFHandleGenerations::SetGeneration(uint32 SlotIndex, uint32 Generation)
+{
+	check(IsInGameThread());
+	check(SlotIndex < MaxSlots);
+
+	std::atomic<uint32>* Chunk = Chunks[SlotIndex / ChunkSize].load(std::memory_order_relaxed);
+	if (Chunk == nullptr)
+	{
+		Chunk = new std::atomic<uint32>[ChunkSize];
+		for (uint32 Index = 0; Index < ChunkSize; Index++)
+		{
+			Chunk[Index].store(0, std::memory_order_relaxed);
+		}
+		Chunks[SlotIndex / ChunkSize].store(Chunk, std::memory_order_release);
+	}
+
+	Chunk[SlotIndex % ChunkSize].store(Generation, std::memory_order_release);
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
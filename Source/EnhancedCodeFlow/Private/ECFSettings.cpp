@@ -0,0 +1,12 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFSettings.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UECFSettings::UECFSettings()
+{
+	CategoryName = TEXT("Plugins");
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -2,13 +2,56 @@
 
 #include "ECFSubsystem.h"
 #include "ECFActionBase.h"
+#include "ECFSettings.h"
+#include "ECFAsyncTask.h"
+#include "CodeFlowActions/ECFDelay.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Async/ParallelFor.h"
+#include <atomic>
+#include "Misc/App.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 DEFINE_STAT(STAT_ECF_ActionsCount);
 DEFINE_STAT(STAT_ECF_InstancesCount);
+DEFINE_STAT(STAT_ECF_SleepingActionsCount);
+DEFINE_STAT(STAT_ECF_PooledActionsCount);
+DEFINE_STAT(STAT_ECF_LightActionsCount);
+DEFINE_STAT(STAT_ECF_DeferredActionsCount);
+DEFINE_STAT(STAT_ECF_CompletionsCount);
+DEFINE_STAT(STAT_ECF_CompletionLatency);
+DEFINE_STAT(STAT_ECF_AsyncQueueDepth);
+DEFINE_STAT(STAT_ECF_AsyncTasksInFlight);
+DEFINE_STAT(STAT_ECF_AsyncWaitTime);
+DEFINE_STAT(STAT_ECF_AsyncRunTime);
+
+void FECFTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		// The engine gives tick functions the delta time dilated by the world. Actions get the time dilation from the tick context,
+		// so tick them with the undilated delta time, the same one the subsystem gets in its own tick.
+		Subsystem->TickActions(ActionsTickGroup, FApp::GetDeltaTime());
+
+		// The subsystem enables this function again when the group gets new actions.
+		if (Subsystem->HasActionsToTick(ActionsTickGroup) == false)
+		{
+			SetTickFunctionEnable(false);
+		}
+	}
+}
+
+FString FECFTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("ECF Tick Function [%s]"), *StaticEnum<EECFTickGroup>()->GetNameStringByValue(static_cast<int64>(ActionsTickGroup)));
+}
+
+FName FECFTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("ECFTickFunction"));
+}
 
 void UECFSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -26,14 +69,95 @@ void UECFSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 		}
 	}
 
-	// Reset the HandleId counter
-	LastHandleId.Invalidate();
+	// Reset the slots of actions.
+	Slots.Empty();
+	FreeSlots.Empty();
+	LightDelays.Empty();
+	LightDelayIndices.Empty();
+	InstancedActions.Empty();
+	ActionsByOwner.Empty();
+	Generations = MakeShared<FECFHandleGenerations, ESPMode::ThreadSafe>();
+	CommandQueue = MakeShared<FECFCommandQueue, ESPMode::ThreadSafe>();
+	CompletionQueue = MakeShared<FECFCompletionQueue, ESPMode::ThreadSafe>();
+	LastCompletionLatency = 0.0;
+	ReservedHandleToUse.Invalidate();
+	Clocks.Empty();
+	ClockIndices.Empty();
+	AddDefaultClocks();
+	ResetTimeLanes();
+
+	// Setup pools of actions. Only the subsystem which ticks needs them to be filled.
+	const UECFSettings* ECFSettings = GetDefault<UECFSettings>();
+	bUseLightDelays = ECFSettings->bUseLightDelays;
+	TickBudgetSeconds = ECFSettings->TickBudgetMs / 1000.0;
+	bUseActionsPool = ECFSettings->bUseActionsPool;
+	MaxPooledActionsPerClass = ECFSettings->MaxPooledActionsPerClass;
+	MaxParallelTickThreadsNum = ECFSettings->MaxParallelTickThreads;
+	FECFAsyncTask::SetMaxTasksInFlight(ECFSettings->MaxAsyncTasksInFlight);
+	if (bCanTick)
+	{
+		PrewarmActionsPools();
+		ReserveHandles();
+	}
+
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UECFSubsystem::OnPostGarbageCollect);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UECFSubsystem::OnWorldCleanup);
 }
 
 void UECFSubsystem::Deinitialize()
 {
-	Actions.Empty();
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	UnregisterTickFunctions();
+
+	// Unbind from owners that are still alive.
+	for (const TPair<FObjectKey, FECFOwnerActions>& OwnerActions : ActionsByOwner)
+	{
+		if (OwnerActions.Value.bBoundToEndPlay)
+		{
+			if (AActor* OwnerActor = Cast<AActor>(OwnerActions.Key.ResolveObjectPtr()))
+			{
+				OwnerActor->OnEndPlay.RemoveDynamic(this, &UECFSubsystem::OnOwnerEndPlay);
+			}
+		}
+	}
+
+	// Stop accepting commands and release handles reserved for them.
+	CommandQueue->Close();
+	FECFHandle ReservedHandle;
+	while (CommandQueue->TakeReservedHandle(ReservedHandle))
+	{
+		ReleaseHandle(ReservedHandle);
+	}
+
+	// Release all used slots, so every handle still stored on other threads becomes invalid.
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); SlotIndex++)
+	{
+		if (IsValid(Slots[SlotIndex]))
+		{
+			Slots[SlotIndex]->OnRemoved();
+		}
+		if (Slots[SlotIndex] || (LightDelayIndices[SlotIndex] != INDEX_NONE))
+		{
+			ReleaseHandle(FECFHandle(SlotIndex, Generations->GetGeneration(SlotIndex)));
+		}
+	}
+
+	ActionBuckets.Empty();
+	ActionBucketIndices.Empty();
+	ActionPools.Empty();
 	PendingAddActions.Empty();
+	Slots.Empty();
+	FreeSlots.Empty();
+	LightDelays.Empty();
+	LightDelayIndices.Empty();
+	DueLightDelays.Empty();
+	FiringLightDelays.Empty();
+	InstancedActions.Empty();
+	ActionsByOwner.Empty();
+	ResetTimeLanes();
+	Clocks.Empty();
+	ClockIndices.Empty();
 }
 
 UECFSubsystem* UECFSubsystem::Get(const UObject* WorldContextObject)
@@ -70,6 +194,12 @@ UECFSubsystem* UECFSubsystem::Get(const UObject* WorldContextObject)
 	return nullptr;
 }	
 
+bool UECFSubsystem::IsTickable() const
+{
+	// There is no need to tick when the subsystem is paused or when there are only dormant actions.
+	return bCanTick && (bIsECFPaused == false) && HasActionsToTick();
+}
+
 void UECFSubsystem::Tick(float DeltaTime)
 {
 	// Do nothing when the whole subsystem is paused
@@ -78,6 +208,123 @@ void UECFSubsystem::Tick(float DeltaTime)
 		return;
 	}
 
+	TickActions(EECFTickGroup::Default, DeltaTime);
+
+	// Tick groups that have got work need their tick functions to be ticked from the next frame.
+	UpdateTickFunctions();
+
+	// Reclaim memory left after spikes of actions from time to time.
+	if (++FramesSinceBuffersShrink >= BuffersShrinkInterval)
+	{
+		FramesSinceBuffersShrink = 0;
+		ShrinkBuffers();
+	}
+}
+
+void UECFSubsystem::PrepareFrame(float DeltaTime)
+{
+	if (LastPreparedFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastPreparedFrame = GFrameCounter;
+
+	// Start and control actions requested by other threads, before anything else happens in this frame.
+	ExecuteCommands();
+	ReserveHandles();
+
+	// Wake up actions which awaited work has been completed, so they are ticked in this frame.
+	DrainCompletions();
+
+#if STATS
+	const FECFAsyncExecutorStats ExecutorStats = FECFAsyncTask::GetExecutorStats();
+	SET_DWORD_STAT(STAT_ECF_AsyncQueueDepth, ExecutorStats.QueuedTasksNum);
+	SET_DWORD_STAT(STAT_ECF_AsyncTasksInFlight, ExecutorStats.TasksInFlightNum);
+	SET_FLOAT_STAT(STAT_ECF_AsyncWaitTime, ExecutorStats.AverageWaitTime * 1000.0);
+	SET_FLOAT_STAT(STAT_ECF_AsyncRunTime, ExecutorStats.AverageRunTime * 1000.0);
+#endif
+
+	// The budget is shared by all tick groups of the frame.
+	FrameBudgetLeft = TickBudgetSeconds;
+	LastFrameDeferredActionsNum = DeferredActionsNum;
+	DeferredActionsNum = 0;
+
+	// The state of the world is the same for all actions, so get it once per frame.
+	const FECFTickContext TickContext = MakeTickContext(DeltaTime);
+
+	// Advance the time and wake up actions which are done sleeping
+	AdvanceTimeLanes(TickContext);
+
+	// Move woken up actions back to the awake ones
+	for (const FECFHandle& WakingUpHandle : WakingUpActions)
+	{
+		UECFActionBase* WakingUpAction = GetActionFromSlot(WakingUpHandle);
+		if (WakingUpAction && WakingUpAction->bIsWakingUp)
+		{
+			WakingUpAction->bIsWakingUp = false;
+			GetActionsBucket(WakingUpAction).WakeUp(WakingUpAction);
+		}
+	}
+	WakingUpActionsPeak = FMath::Max(WakingUpActionsPeak, WakingUpActions.Num());
+	WakingUpActions.Reset();
+
+	// Add all valid pending actions to the buckets of their classes. Actions started as paused are dormant from the beginning.
+	// Event-only actions are never ticked, so they are kept with the sleeping ones until they are removed.
+	// The pending list keeps its capacity, so adding actions doesn't allocate every frame.
+	for (UECFActionBase* PendingAddAction : PendingAddActions)
+	{
+		if (PurgeInvalidAction(PendingAddAction))
+		{
+			continue;
+		}
+
+		if (PendingAddAction->bIsEventAction)
+		{
+			GetActionsBucket(PendingAddAction).AddSleeping(PendingAddAction);
+		}
+		else if (PendingAddAction->bIsPaused)
+		{
+			PendingAddAction->bIsDormant = true;
+			GetActionsBucket(PendingAddAction).AddSleeping(PendingAddAction);
+		}
+		else
+		{
+			GetActionsBucket(PendingAddAction).AddAwake(PendingAddAction);
+		}
+	}
+	PendingAddActionsPeak = FMath::Max(PendingAddActionsPeak, PendingAddActions.Num());
+	PendingAddActions.Reset();
+
+#if STATS
+	SET_DWORD_STAT(STAT_ECF_ActionsCount, GetActiveActionsCount());
+	SET_DWORD_STAT(STAT_ECF_InstancesCount, InstancedActions.Num());
+	SET_DWORD_STAT(STAT_ECF_SleepingActionsCount, 0);
+	SET_DWORD_STAT(STAT_ECF_DeferredActionsCount, 0);
+	SET_DWORD_STAT(STAT_ECF_LightActionsCount, LightDelays.Num());
+
+	int32 PooledActionsNum = 0;
+	for (const TPair<UClass*, FECFActionsPool>& ActionsPool : ActionPools)
+	{
+		PooledActionsNum += ActionsPool.Value.Actions.Num();
+	}
+	SET_DWORD_STAT(STAT_ECF_PooledActionsCount, PooledActionsNum);
+#endif
+
+	// Get the state of the world as seen by every clock.
+	ClockTickContexts.Reset();
+	for (const TUniquePtr<FECFClock>& Clock : Clocks)
+	{
+		ClockTickContexts.Add(MakeClockTickContext(TickContext, *Clock));
+	}
+}
+
+void UECFSubsystem::TickActions(EECFTickGroup TickGroup, float DeltaTime)
+{
+	if (bIsECFPaused)
+	{
+		return;
+	}
+
 #if STATS
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Tick"), STAT_ECF_TickAll, STATGROUP_ECF);
 #endif
@@ -86,51 +333,302 @@ void UECFSubsystem::Tick(float DeltaTime)
 	TRACE_CPUPROFILER_EVENT_SCOPE("ECF - Subsystem Tick");
 #endif
 
-	// Remove all expired actions first
-	Actions.RemoveAll([](UECFActionBase* Action) { return IsActionValid(Action) == false; });
+	const double TickStartTime = FPlatformTime::Seconds();
 
-	// There might be a situation the pending action is invalid too
-	PendingAddActions.RemoveAll([&](UECFActionBase* PendingAddAction) { return IsActionValid(PendingAddAction) == false; });
+	PrepareFrame(DeltaTime);
 
-	// Add all pending actions
-	Actions.Append(PendingAddActions);
-	PendingAddActions.Empty();
+	// Light delays are not ticked, so finish them as soon as they are due. They always use the Default tick group.
+	if (TickGroup == EECFTickGroup::Default)
+	{
+		FireDueLightDelays();
+	}
+
+	// Tick all awake actions of the tick group, one class at a time. Remove expired actions and put to sleep
+	// actions which don't have to be ticked for some time. Critical actions are always ticked.
+	for (FECFActionsBucket& Bucket : ActionBuckets)
+	{
+		if ((Bucket.TickGroup == TickGroup) && (Bucket.Priority == EECFPriority::Critical))
+		{
+			TickBucket(Bucket, TNumericLimits<double>::Max());
+		}
+	}
+
+	// Actions of other priorities are ticked until the budget is spent. Each priority starts from the bucket
+	// in which the budget has been spent last time, and deferred actions are moved to the front of their buckets,
+	// so all actions are ticked in turns.
+	const double BudgetEndTime = (TickBudgetSeconds > 0.0) ? (TickStartTime + FMath::Max(FrameBudgetLeft, 0.0)) : TNumericLimits<double>::Max();
+	const int32 BucketsNum = ActionBuckets.Num();
+	bool bBudgetSpent = false;
+	for (int32 PriorityIndex = static_cast<int32>(EECFPriority::Normal); PriorityIndex < PrioritiesNum; PriorityIndex++)
+	{
+		const EECFPriority Priority = static_cast<EECFPriority>(PriorityIndex);
+		int32& BudgetCursor = BudgetCursors[static_cast<int32>(TickGroup)][PriorityIndex];
+		const int32 FirstBucketIndex = (BudgetCursor < BucketsNum) ? BudgetCursor : 0;
+		for (int32 BucketOffset = 0; BucketOffset < BucketsNum; BucketOffset++)
+		{
+			const int32 BucketIndex = (FirstBucketIndex + BucketOffset) % BucketsNum;
+			FECFActionsBucket& Bucket = ActionBuckets[BucketIndex];
+			if ((Bucket.TickGroup != TickGroup) || (Bucket.Priority != Priority))
+			{
+				continue;
+			}
+
+			if (bBudgetSpent)
+			{
+				DeferActions(Bucket, 0);
+			}
+			else if (TickBucket(Bucket, BudgetEndTime) == false)
+			{
+				bBudgetSpent = true;
+				BudgetCursor = BucketIndex;
+			}
+		}
+	}
 
+	if (TickBudgetSeconds > 0.0)
+	{
+		FrameBudgetLeft -= FPlatformTime::Seconds() - TickStartTime;
+	}
+}
+
+bool UECFSubsystem::TickBucket(FECFActionsBucket& Bucket, double BudgetEndTime)
+{
 #if STATS
-	SET_DWORD_STAT(STAT_ECF_ActionsCount, Actions.Num());
-	SET_DWORD_STAT(STAT_ECF_InstancesCount, 0);
+	INC_DWORD_STAT_BY(STAT_ECF_SleepingActionsCount, Bucket.Actions.Num() - Bucket.AwakeNum);
 #endif
 
-	// Tick all active actions
-	for (UECFActionBase* Action : Actions)
+	// Actions of paused clocks and actions which don't ignore the pause while the world is paused are not
+	// visited at all. They will be validated and removed if needed when they can be ticked again.
+	if (CanTickBucket(Bucket) == false)
+	{
+		return true;
+	}
+
+	if (Bucket.bThreadSafeTick && (Bucket.AwakeNum >= MinParallelTickActionsNum))
+	{
+		return TickBucketInParallel(Bucket, BudgetEndTime);
+	}
+
+	const FECFTickContext& ClockTickContext = ClockTickContexts[Bucket.ClockIndex];
+	const bool bIsBudgeted = BudgetEndTime < TNumericLimits<double>::Max();
+	int32 ActionIndex = 0;
+	while (ActionIndex < Bucket.AwakeNum)
 	{
-		if (IsActionValid(Action))
+		if (bIsBudgeted && (FPlatformTime::Seconds() >= BudgetEndTime))
 		{
-#if STATS
-			if (Action->InstanceId.IsValid())
+			DeferActions(Bucket, ActionIndex);
+			return false;
+		}
+
+		// Validate the action once per frame. After the tick it is enough to check if the action has finished
+		// or its owner has been torn down in the meantime. Any other invalidation will be caught in the next frame.
+		UECFActionBase* Action = Bucket.Actions[ActionIndex];
+		if (IsActionAlive(Action) == false)
+		{
+			Bucket.RemoveAwake(ActionIndex);
+			ForgetAction(Action);
+			continue;
+		}
+
+		TickAction(Action, ClockTickContext);
+
+		if (UpdateTickedAction(Bucket, ActionIndex))
+		{
+			ActionIndex++;
+		}
+	}
+
+	return true;
+}
+
+bool UECFSubsystem::TickBucketInParallel(FECFActionsBucket& Bucket, double BudgetEndTime)
+{
+#if ECF_INSIGHT_PROFILING
+	TRACE_CPUPROFILER_EVENT_SCOPE("ECF - Parallel Tick");
+#endif
+
+	// Owners can't be checked on worker threads, so validate actions before the parallel ticks.
+	int32 ActionIndex = 0;
+	while (ActionIndex < Bucket.AwakeNum)
+	{
+		UECFActionBase* Action = Bucket.Actions[ActionIndex];
+		if (IsActionAlive(Action) == false)
+		{
+			Bucket.RemoveAwake(ActionIndex);
+			ForgetAction(Action);
+			continue;
+		}
+		ActionIndex++;
+	}
+
+	// Actions of the same owner are usually started together, so they are kept close to each other in the bucket.
+	// Threads take contiguous chunks of the bucket in order, checking the budget before every chunk, so the ticked
+	// chunks are always the first ones. Ticks don't change the bucket, so the rest of it can be deferred afterwards.
+	const FECFTickContext& ClockTickContext = ClockTickContexts[Bucket.ClockIndex];
+	const int32 AwakeNum = Bucket.AwakeNum;
+	const int32 ChunksNum = FMath::DivideAndRoundUp(AwakeNum, ParallelTickChunkSize);
+	int32 ThreadsNum = FMath::Min(FTaskGraphInterface::Get().GetNumWorkerThreads() + 1, ChunksNum);
+	if (MaxParallelTickThreadsNum > 0)
+	{
+		ThreadsNum = FMath::Min(ThreadsNum, MaxParallelTickThreadsNum);
+	}
+
+	const bool bIsBudgeted = BudgetEndTime < TNumericLimits<double>::Max();
+	std::atomic<int32> NextChunkIndex { 0 };
+	ParallelFor(ThreadsNum, [this, &Bucket, &ClockTickContext, &NextChunkIndex, AwakeNum, ChunksNum, bIsBudgeted, BudgetEndTime](int32 ThreadIndex)
+	{
+		while ((bIsBudgeted == false) || (FPlatformTime::Seconds() < BudgetEndTime))
+		{
+			const int32 ChunkIndex = NextChunkIndex++;
+			if (ChunkIndex >= ChunksNum)
 			{
-				INC_DWORD_STAT(STAT_ECF_InstancesCount);
+				return;
 			}
-#endif
-			Action->DoTick(DeltaTime);
+
+			const int32 LastIndex = FMath::Min((ChunkIndex + 1) * ParallelTickChunkSize, AwakeNum);
+			for (int32 Index = ChunkIndex * ParallelTickChunkSize; Index < LastIndex; Index++)
+			{
+				UECFActionBase* Action = Bucket.Actions[Index];
+				Action->bIsTickingInParallel = true;
+				TickAction(Action, ClockTickContext);
+				Action->bIsTickingInParallel = false;
+			}
+		}
+	});
+
+	// Defer actions of the chunks that haven't been taken. They are moved to the front of the bucket,
+	// so the ticked actions are the last ones.
+	const int32 TickedActionsNum = FMath::Min(NextChunkIndex.load() * ParallelTickChunkSize, AwakeNum);
+	const bool bBudgetSpent = TickedActionsNum < AwakeNum;
+	ActionIndex = 0;
+	if (bBudgetSpent)
+	{
+		DeferActions(Bucket, TickedActionsNum);
+		ActionIndex = AwakeNum - TickedActionsNum;
+	}
+
+	// Call deferred completions while visiting ticked actions the same way the serial tick does, including the actions
+	// moved by removals, so they are called in the same order as if the bucket was ticked on the game thread.
+	while (ActionIndex < Bucket.AwakeNum)
+	{
+		UECFActionBase* Action = Bucket.Actions[ActionIndex];
+		if (Action->bHasPendingComplete)
+		{
+			Action->bHasPendingComplete = false;
+			Action->Complete(false);
+		}
+
+		if (UpdateTickedAction(Bucket, ActionIndex))
+		{
+			ActionIndex++;
 		}
 	}
+
+	return bBudgetSpent == false;
 }
 
-UECFActionBase* UECFSubsystem::FindAction(const FECFHandle& HandleId) const
+void UECFSubsystem::TickAction(UECFActionBase* Action, const FECFTickContext& ClockTickContext)
+{
+	// Paused actions keep the lane time of their last tick, so the whole time until they are resumed counts as paused.
+	if (Action->bIsPaused)
+	{
+		Action->bIsDeferred = false;
+		return;
+	}
+
+	Action->TickLaneTime = GetTimeLane(Action).Time;
+
+	// Deferred actions are ticked with the whole time they have been waiting for.
+	if (Action->bIsDeferred)
+	{
+		Action->bIsDeferred = false;
+		Action->DoScaledTick(static_cast<float>(GetTimeLane(Action).Time - Action->DeferredLaneTime));
+	}
+	else
+	{
+		Action->DoTick(ClockTickContext);
+	}
+}
+
+bool UECFSubsystem::UpdateTickedAction(FECFActionsBucket& Bucket, int32 Index)
 {
-	if (HandleId.IsValid())
+	UECFActionBase* Action = Bucket.Actions[Index];
+	if (Action->bHasFinished || Action->bOwnerTornDown)
+	{
+		Bucket.RemoveAwake(Index);
+		ForgetAction(Action);
+		return false;
+	}
+
+	// Paused actions are dormant until they are resumed. Event-only actions are awake only to be removed,
+	// so if they are still alive - move them back out of the tick loop.
+	if (Action->bIsPaused || Action->bIsEventAction)
 	{
-		if (UECFActionBase* const* ActionFound = Actions.FindByPredicate([&](UECFActionBase* Action) { return (IsActionValid(Action) && (Action->GetHandleId() == HandleId)); }))
+		Action->bIsDormant = (Action->bIsEventAction == false);
+		Bucket.FallAsleep(Index);
+		return false;
+	}
+
+	// Actions waiting for a completion are kept out of the tick loop until it is notified. Actions with a timeout
+	// sleep in the timer wheel until it passes, unless it is too close to sleep - then they are ticked normally.
+	if (Action->IsWaitingForCompletion() && (Action->bFirstTick == false))
+	{
+		if (Action->GetAllowedSleepTime() <= 0.f)
 		{
-			return *ActionFound;
+			Action->bIsAwaitingCompletion = true;
+			Bucket.FallAsleep(Index);
+			return false;
 		}
-		else if (UECFActionBase* const* PendingActionFound = PendingAddActions.FindByPredicate([&](UECFActionBase* PendingAddAction) { return (IsActionValid(PendingAddAction) && (PendingAddAction->GetHandleId() == HandleId)); }))
+		if (TryPutActionToSleep(Bucket, Index))
+		{
+			Action->bIsAwaitingCompletion = true;
+			return false;
+		}
+		return true;
+	}
+
+	return TryPutActionToSleep(Bucket, Index) == false;
+}
+
+bool UECFSubsystem::CanTickBucket(const FECFActionsBucket& Bucket) const
+{
+	return (Clocks[Bucket.ClockIndex]->bIsPaused == false) && ClockTickContexts[Bucket.ClockIndex].CanTick(Bucket.bIgnorePause);
+}
+
+void UECFSubsystem::DeferActions(FECFActionsBucket& Bucket, int32 FirstIndex)
+{
+	if ((FirstIndex >= Bucket.AwakeNum) || (CanTickBucket(Bucket) == false))
+	{
+		return;
+	}
+
+	// Deferred actions have been ticked up to the beginning of this frame.
+	for (int32 ActionIndex = FirstIndex; ActionIndex < Bucket.AwakeNum; ActionIndex++)
+	{
+		UECFActionBase* Action = Bucket.Actions[ActionIndex];
+		if (Action && (Action->bIsDeferred == false))
 		{
-			return *PendingActionFound;
+			Action->bIsDeferred = true;
+			Action->DeferredLaneTime = GetTimeLane(Action).PreviousTime;
 		}
 	}
 
+	DeferredActionsNum += Bucket.AwakeNum - FirstIndex;
+#if STATS
+	INC_DWORD_STAT_BY(STAT_ECF_DeferredActionsCount, Bucket.AwakeNum - FirstIndex);
+#endif
+
+	Bucket.MoveToFront(FirstIndex);
+}
+
+UECFActionBase* UECFSubsystem::FindAction(const FECFHandle& HandleId) const
+{
+	UECFActionBase* ActionFound = GetActionFromSlot(HandleId);
+	if (IsActionValid(ActionFound))
+	{
+		return ActionFound;
+	}
+
 #if ECF_LOGS
 	UE_LOG(LogECF, Error, TEXT("Couldn't find action of handle %s"), *HandleId.ToString());
 #endif
@@ -145,12 +643,18 @@ TArray<FECFHandle> UECFSubsystem::GetActionsHandlesByClass(TSubclassOf<UECFActio
 	{
 		return Result;
 	}
-	// Search in active actions
-	for (UECFActionBase* Action : Actions)
+	// Search in active actions, in all buckets of the class
+	for (const FECFActionsBucket& Bucket : ActionBuckets)
 	{
-		if (IsActionValid(Action) && (Action->GetClass() == Class))
+		if (Bucket.Class == Class)
 		{
-			Result.Add(Action->GetHandleId());
+			for (UECFActionBase* Action : Bucket.Actions)
+			{
+				if (IsActionValid(Action))
+				{
+					Result.Add(Action->GetHandleId());
+				}
+			}
 		}
 	}
 	// Search in pending actions
@@ -161,6 +665,11 @@ TArray<FECFHandle> UECFSubsystem::GetActionsHandlesByClass(TSubclassOf<UECFActio
 			Result.Add(PendingAction->GetHandleId());
 		}
 	}
+	// Search in light delays
+	if (Class == UECFDelay::StaticClass())
+	{
+		Result.Append(GetLightDelaysOfOwner(nullptr));
+	}
 	return Result;
 }
 
@@ -172,11 +681,14 @@ TArray<FECFHandle> UECFSubsystem::GetActionsHandlesByLabel(const FString& Label)
 		return Result;
 	}
 	// Search in active actions
-	for (UECFActionBase* Action : Actions)
+	for (const FECFActionsBucket& Bucket : ActionBuckets)
 	{
-		if (IsActionValid(Action) && (Action->Settings.Label == Label))
+		for (UECFActionBase* Action : Bucket.Actions)
 		{
-			Result.Add(Action->GetHandleId());
+			if (IsActionValid(Action) && (Action->Settings.Label == Label))
+			{
+				Result.Add(Action->GetHandleId());
+			}
 		}
 	}
 	// Search in pending actions
@@ -187,6 +699,14 @@ TArray<FECFHandle> UECFSubsystem::GetActionsHandlesByLabel(const FString& Label)
 			Result.Add(PendingAction->GetHandleId());
 		}
 	}
+	// Search in light delays
+	for (int32 LightDelayIndex = 0; LightDelayIndex < LightDelays.GetMaxIndex(); LightDelayIndex++)
+	{
+		if (LightDelays.IsAllocated(LightDelayIndex) && (LightDelays[LightDelayIndex].Label == Label))
+		{
+			Result.Add(LightDelays[LightDelayIndex].Handle);
+		}
+	}
 	return Result;
 }
 
@@ -194,23 +714,45 @@ TArray<UECFActionBase*> UECFSubsystem::GetAllActions() const
 {
 	TArray<UECFActionBase*> Result;
 	Result.Reserve(GetActionsCount());
-	Result.Append(Actions);
+	for (const FECFActionsBucket& Bucket : ActionBuckets)
+	{
+		Result.Append(Bucket.Actions);
+	}
 	Result.Append(PendingAddActions);
 	return Result;
 }
 
 int32 UECFSubsystem::GetActionsCount() const
 {
-	return Actions.Num() + PendingAddActions.Num();
+	return GetActiveActionsCount() + PendingAddActions.Num() + LightDelays.Num();
+}
+
+FECFActionsPoolStats UECFSubsystem::GetActionsPoolStats() const
+{
+	FECFActionsPoolStats Stats;
+	for (const TPair<UClass*, FECFActionsPool>& ActionsPool : ActionPools)
+	{
+		Stats.PooledActionsNum += ActionsPool.Value.Actions.Num();
+	}
+	Stats.ReusedActionsNum = ReusedActionsNum;
+	Stats.CreatedActionsNum = CreatedActionsNum;
+	return Stats;
 }
 
 void UECFSubsystem::PauseAction(const FECFHandle& HandleId)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	if (FECFLightDelay* LightDelay = FindLightDelay(HandleId))
+	{
+		SetLightDelayPaused(*LightDelay, true);
+	}
+	else if (UECFActionBase* ActionFound = FindAction(HandleId))
 	{
 #if (ECF_LOGS && ECF_LOGS_VERBOSE)
 		UE_LOG(LogECF, Verbose, TEXT("Paused Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
 #endif
+		// Wake up the sleeping action, so it gets the time it has slept before the pause.
+		// It will become dormant during the next tick.
+		WakeUpAction(ActionFound);
 		ActionFound->bIsPaused = true;
 	}
 	else
@@ -223,12 +765,23 @@ void UECFSubsystem::PauseAction(const FECFHandle& HandleId)
 
 void UECFSubsystem::ResumeAction(const FECFHandle& HandleId)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	if (FECFLightDelay* LightDelay = FindLightDelay(HandleId))
+	{
+		SetLightDelayPaused(*LightDelay, false);
+	}
+	else if (UECFActionBase* ActionFound = FindAction(HandleId))
 	{
 #if (ECF_LOGS && ECF_LOGS_VERBOSE)
 		UE_LOG(LogECF, Verbose, TEXT("Resume Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
 #endif
+		// Paused actions are not ticked, so the lane time since their last tick has been spent in the pause.
+		if (ActionFound->bIsPaused)
+		{
+			ActionFound->PausedLaneTime += GetTimeLane(ActionFound).Time - ActionFound->TickLaneTime;
+			ActionFound->TickLaneTime = GetTimeLane(ActionFound).Time;
+		}
 		ActionFound->bIsPaused = false;
+		WakeUpDormantAction(ActionFound);
 	}
 	else
 	{
@@ -240,6 +793,11 @@ void UECFSubsystem::ResumeAction(const FECFHandle& HandleId)
 
 bool UECFSubsystem::IsActionPaused(const FECFHandle& HandleId, bool& bIsPaused) const
 {
+	if (const FECFLightDelay* LightDelay = FindLightDelay(HandleId))
+	{
+		bIsPaused = LightDelay->bIsPaused;
+		return true;
+	}
 	if (UECFActionBase* ActionFound = FindAction(HandleId))
 	{
 		bIsPaused = ActionFound->bIsPaused;
@@ -250,6 +808,19 @@ bool UECFSubsystem::IsActionPaused(const FECFHandle& HandleId, bool& bIsPaused)
 
 bool UECFSubsystem::ResetAction(const FECFHandle& HandleId, bool bCallUpdate)
 {
+	if (FECFLightDelay* LightDelay = FindLightDelay(HandleId))
+	{
+		if (LightDelay->bIsPaused)
+		{
+			LightDelay->TimeLeft = LightDelay->DelayTime;
+		}
+		else
+		{
+			ScheduleLightDelay(*LightDelay, LightDelay->DelayTime);
+		}
+		return true;
+	}
+
 	if (UECFActionBase* ActionFound = FindAction(HandleId))
 	{
 		if (IsActionValid(ActionFound))
@@ -257,6 +828,7 @@ bool UECFSubsystem::ResetAction(const FECFHandle& HandleId, bool bCallUpdate)
 #if (ECF_LOGS && ECF_LOGS_VERBOSE)
 			UE_LOG(LogECF, Verbose, TEXT("Reset Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
 #endif
+			WakeUpAction(ActionFound);
 			return ActionFound->Reset(bCallUpdate);
 		}
 	}
@@ -270,9 +842,14 @@ bool UECFSubsystem::ResetAction(const FECFHandle& HandleId, bool bCallUpdate)
 
 void UECFSubsystem::RemoveAction(FECFHandle& HandleId, bool bComplete)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	if (FECFLightDelay* LightDelay = FindLightDelay(HandleId))
 	{
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+		FinishLightDelay(*LightDelay, bComplete, true);
+		HandleId.Invalidate();
+	}
+	else if (UECFActionBase* ActionFound = FindAction(HandleId))
+	{
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
 		UE_LOG(LogECF, Verbose, TEXT("Remove Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
 #endif
 		FinishAction(ActionFound, bComplete);
@@ -300,35 +877,53 @@ void UECFSubsystem::RemoveActionsOfClass(TSubclassOf<UECFActionBase> ActionClass
 	UE_LOG(LogECF, Verbose, TEXT("Removing Actions of class: %s"), *ActionClass->GetName());
 #endif
 
-	// Find running actions of given class assigned to a specific owner (if specified) and set it as finished.
-	for (UECFActionBase* Action : Actions)
+	// Light delays are handled as delays.
+	if (UECFDelay::StaticClass()->IsChildOf(ActionClass))
+	{
+		for (const FECFHandle& LightDelayHandle : GetLightDelaysOfOwner(InOwner))
+		{
+			if (FECFLightDelay* LightDelay = FindLightDelay(LightDelayHandle))
+			{
+				FinishLightDelay(*LightDelay, bComplete, true);
+			}
+		}
+	}
+
+	// Find running and pending actions of given class assigned to a specific owner and set it as finished.
+	if (InOwner)
 	{
-		if (IsActionValid(Action))
+		for (UECFActionBase* Action : GetActionsOfOwner(InOwner))
 		{
 			if (Action->IsA(ActionClass))
 			{
-				if (InOwner == nullptr || InOwner == Action->Owner)
-				{
-					FinishAction(Action, bComplete);
-				}
+				FinishAction(Action, bComplete);
 			}
 		}
+		return;
 	}
 
-	// Also check pending actions to prevent from launching it.
-	for (UECFActionBase* PendingAction : PendingAddActions)
+	// If there is no owner specified, check only buckets of the given class (and its child classes).
+	for (FECFActionsBucket& Bucket : ActionBuckets)
 	{
-		if (IsActionValid(PendingAction))
+		if (Bucket.Class->IsChildOf(ActionClass))
 		{
-			if (PendingAction->IsA(ActionClass))
+			for (UECFActionBase* Action : Bucket.Actions)
 			{
-				if (InOwner == nullptr || InOwner == PendingAction->Owner)
-				{
-					FinishAction(PendingAction, bComplete);
-				}
+				FinishAction(Action, bComplete);
 			}
 		}
 	}
+
+	// Also check pending actions to prevent from launching it.
+	// New actions can be added while completing the others, so don't use the ranged loop here.
+	for (int32 PendingIndex = 0; PendingIndex < PendingAddActions.Num(); PendingIndex++)
+	{
+		UECFActionBase* PendingAction = PendingAddActions[PendingIndex];
+		if (IsActionValid(PendingAction) && PendingAction->IsA(ActionClass))
+		{
+			FinishAction(PendingAction, bComplete);
+		}
+	}
 }
 
 void UECFSubsystem::RemoveActionsOfLabel(const FString& Label, bool bComplete, UObject* InOwner)
@@ -345,33 +940,20 @@ void UECFSubsystem::RemoveActionsOfLabel(const FString& Label, bool bComplete, U
 	UE_LOG(LogECF, Verbose, TEXT("Removing Actions of Label: %s"), *Label);
 #endif
 
-	// Find running actions of given class assigned to a specific owner (if specified) and set it as finished.
-	for (UECFActionBase* Action : Actions)
+	// Find running and pending actions with given Label assigned to a specific owner (if specified) and set it as finished.
+	for (UECFActionBase* Action : GetActionsOfOwner(InOwner))
 	{
-		if (IsActionValid(Action))
+		if (Action->GetLabel() == Label)
 		{
-			if (Action->GetLabel() == Label)
-			{
-				if (InOwner == nullptr || InOwner == Action->Owner)
-				{
-					FinishAction(Action, bComplete);
-				}
-			}
+			FinishAction(Action, bComplete);
 		}
 	}
-
-	// Also check pending actions to prevent from launching it.
-	for (UECFActionBase* PendingAction : PendingAddActions)
+	for (const FECFHandle& LightDelayHandle : GetLightDelaysOfOwner(InOwner))
 	{
-		if (IsActionValid(PendingAction))
+		FECFLightDelay* LightDelay = FindLightDelay(LightDelayHandle);
+		if (LightDelay && (LightDelay->Label == Label))
 		{
-			if (PendingAction->GetLabel() == Label)
-			{
-				if (InOwner == nullptr || InOwner == PendingAction->Owner)
-				{
-					FinishAction(PendingAction, bComplete);
-				}
-			}
+			FinishLightDelay(*LightDelay, bComplete, true);
 		}
 	}
 }
@@ -382,26 +964,10 @@ void UECFSubsystem::RemoveInstancedAction(const FECFInstanceId& InstanceId, bool
 	UE_LOG(LogECF, Verbose, TEXT("Removing Instanced Action of InstanceId: %s"), *InstanceId.ToString());
 #endif
 
-	// Stop all running and pending actions with the given InstanceId.
-	for (UECFActionBase* Action : Actions)
-	{
-		if (IsActionValid(Action))
-		{
-			if (Action->HasInstanceId(InstanceId))
-			{
-				FinishAction(Action, bComplete);
-			}
-		}
-	}
-	for (UECFActionBase* PendingAction : PendingAddActions)
+	// Stop running or pending action with the given InstanceId.
+	if (UECFActionBase* ActionFound = GetInstancedAction(InstanceId, false))
 	{
-		if (IsActionValid(PendingAction))
-		{
-			if (PendingAction->HasInstanceId(InstanceId))
-			{
-				FinishAction(PendingAction, bComplete);
-			}
-		}
+		FinishAction(ActionFound, bComplete);
 	}
 }
 
@@ -411,33 +977,33 @@ void UECFSubsystem::RemoveAllActions(bool bComplete, UObject* InOwner)
 	UE_LOG(LogECF, Verbose, TEXT("Removing All Actions"));
 #endif
 
-	// Stop all running and pending actions.
-	for (UECFActionBase* Action : Actions)
+	// Stop all running and pending actions assigned to a specific owner (if specified).
+	for (UECFActionBase* Action : GetActionsOfOwner(InOwner))
 	{
-		if (IsActionValid(Action))
-		{
-			if (InOwner == nullptr || InOwner == Action->Owner)
-			{
-				FinishAction(Action, bComplete);
-			}
-		}
+		FinishAction(Action, bComplete);
 	}
-	for (UECFActionBase* PendingAction : PendingAddActions)
+	for (const FECFHandle& LightDelayHandle : GetLightDelaysOfOwner(InOwner))
 	{
-		if (IsActionValid(PendingAction))
+		if (FECFLightDelay* LightDelay = FindLightDelay(LightDelayHandle))
 		{
-			if (InOwner == nullptr || InOwner == PendingAction->Owner)
-			{
-				FinishAction(PendingAction, bComplete);
-			}
+			FinishLightDelay(*LightDelay, bComplete, true);
 		}
 	}
 }
 
 float UECFSubsystem::GetActionTime(const FECFHandle& HandleId)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	if (FECFLightDelay* LightDelay = FindLightDelay(HandleId))
+	{
+		return GetLightDelayTime(*LightDelay);
+	}
+	else if (UECFActionBase* ActionFound = FindAction(HandleId))
 	{
+		if (ActionFound->bIsSleeping)
+		{
+			const FECFTimeLane& Lane = GetTimeLane(ActionFound);
+			SyncSleepingAction(ActionFound, Lane.Time, Lane.Frame);
+		}
 		return ActionFound->GetActionTime();
 	}
 	else
@@ -451,8 +1017,25 @@ float UECFSubsystem::GetActionTime(const FECFHandle& HandleId)
 
 bool UECFSubsystem::SetActionTime(const FECFHandle& HandleId, float NewTime, bool bCallUpdate)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	if (FECFLightDelay* LightDelay = FindLightDelay(HandleId))
 	{
+		if (bCallUpdate && (NewTime > LightDelay->DelayTime))
+		{
+			FinishLightDelay(*LightDelay, true, false);
+		}
+		else if (LightDelay->bIsPaused)
+		{
+			LightDelay->TimeLeft = LightDelay->DelayTime - NewTime;
+		}
+		else
+		{
+			ScheduleLightDelay(*LightDelay, LightDelay->DelayTime - NewTime);
+		}
+		return true;
+	}
+	else if (UECFActionBase* ActionFound = FindAction(HandleId))
+	{
+		WakeUpAction(ActionFound);
 		return ActionFound->SetActionTime(NewTime, bCallUpdate);
 	}
 	else
@@ -466,6 +1049,10 @@ bool UECFSubsystem::SetActionTime(const FECFHandle& HandleId, float NewTime, boo
 
 bool UECFSubsystem::HasAction(const FECFHandle& HandleId) const
 {
+	if (FindLightDelay(HandleId))
+	{
+		return true;
+	}
 	if (UECFActionBase* ActionFound = FindAction(HandleId))
 	{
 		return true;
@@ -477,13 +1064,14 @@ UECFActionBase* UECFSubsystem::GetInstancedAction(const FECFInstanceId& Instance
 {
 	if (InstanceId.IsValid())
 	{
-		if (UECFActionBase* const* ActionFound = Actions.FindByPredicate([&](UECFActionBase* Action) { return IsActionValid(Action) && Action->HasInstanceId(InstanceId); }))
-		{
-			return *ActionFound;
-		}
-		else if (UECFActionBase* const* PendingActionFound = PendingAddActions.FindByPredicate([&](UECFActionBase* PendingAction) { return IsActionValid(PendingAction) && PendingAction->HasInstanceId(InstanceId); }))
+		// Handles don't change when actions are moved from pending to running, so the entry is valid in both states.
+		if (const FECFHandle* InstancedHandle = InstancedActions.Find(InstanceId))
 		{
-			return *PendingActionFound;
+			UECFActionBase* ActionFound = GetActionFromSlot(*InstancedHandle);
+			if (IsActionValid(ActionFound) && ActionFound->HasInstanceId(InstanceId))
+			{
+				return ActionFound;
+			}
 		}
 	}
 
@@ -501,6 +1089,8 @@ void UECFSubsystem::FinishAction(UECFActionBase* Action, bool bComplete)
 {
 	if (IsActionValid(Action))
 	{
+		// Sleeping, dormant and event-only actions must be woken up, so they can be removed.
+		WakeUpRemovedAction(Action);
 		Action->MarkAsFinished();
 		if (bComplete)
 		{
@@ -514,4 +1104,1193 @@ bool UECFSubsystem::IsActionValid(UECFActionBase* Action)
 	return IsValid(Action) && (Action->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed) == false) && Action->IsValid();
 }
 
+bool UECFSubsystem::IsActionAlive(UECFActionBase* Action)
+{
+	if (Action && Action->bOwnerNotifiesTeardown)
+	{
+		return (Action->bHasFinished == false) && (Action->bOwnerTornDown == false);
+	}
+	return IsActionValid(Action);
+}
+
+bool UECFSubsystem::PurgeInvalidAction(UECFActionBase* Action)
+{
+	if (IsActionAlive(Action))
+	{
+		return false;
+	}
+
+	ForgetAction(Action);
+	return true;
+}
+
+void UECFSubsystem::ForgetAction(UECFActionBase* Action)
+{
+	if (Action)
+	{
+		// Remove the instanced action entry only if it wasn't already replaced by a newer action.
+		if (Action->InstanceId.IsValid())
+		{
+			const FECFHandle* InstancedHandle = InstancedActions.Find(Action->InstanceId);
+			if (InstancedHandle && (*InstancedHandle == Action->GetHandleId()))
+			{
+				InstancedActions.Remove(Action->InstanceId);
+			}
+		}
+		// Remove the action from its owner's actions.
+		if (FECFOwnerActions* OwnerActions = ActionsByOwner.Find(Action->OwnerKey))
+		{
+			OwnerActions->Handles.RemoveSingleSwap(Action->GetHandleId());
+		}
+		Action->OnRemoved();
+		ReleaseHandle(Action->GetHandleId());
+		ReturnActionToPool(Action);
+	}
+}
+
+void UECFSubsystem::ExecuteCommands()
+{
+	FECFCommandQueue::FCommand Command;
+	while (CommandQueue->Dequeue(Command))
+	{
+		switch (Command.Type)
+		{
+			case FECFCommandQueue::ECommandType::StartAction:
+			{
+				// The first action started by the function takes the reserved handle. Release it if there was no such action.
+				ReservedHandleToUse = Command.Handle;
+				Command.StartFunc();
+				if (ReservedHandleToUse.IsValid())
+				{
+					ReleaseHandle(ReservedHandleToUse);
+					ReservedHandleToUse.Invalidate();
+				}
+				Command.StartFunc.Reset();
+				break;
+			}
+			case FECFCommandQueue::ECommandType::StopAction:
+				RemoveAction(Command.Handle, Command.bComplete);
+				break;
+			case FECFCommandQueue::ECommandType::PauseAction:
+				PauseAction(Command.Handle);
+				break;
+			case FECFCommandQueue::ECommandType::ResumeAction:
+				ResumeAction(Command.Handle);
+				break;
+		}
+	}
+}
+
+void UECFSubsystem::ReserveHandles()
+{
+	while (CommandQueue->GetReservedHandlesNum() < FECFCommandQueue::MaxReservedHandles)
+	{
+		const FECFHandle ReservedHandle = AllocateHandle(nullptr);
+		if ((ReservedHandle.IsValid() == false) || (CommandQueue->AddReservedHandle(ReservedHandle) == false))
+		{
+			ReleaseHandle(ReservedHandle);
+			break;
+		}
+	}
+}
+
+void UECFSubsystem::DrainCompletions()
+{
+#if ECF_INSIGHT_PROFILING
+	TRACE_CPUPROFILER_EVENT_SCOPE("ECF - Drain Completions");
+#endif
+
+	const double DrainTime = FPlatformTime::Seconds();
+	double MaxLatency = 0.0;
+	int32 CompletionsNum = 0;
+
+	// Completions of removed actions are ignored, as their handles are not current anymore.
+	FECFCompletionQueue::FCompletion Completion;
+	while (CompletionQueue->Pop(Completion))
+	{
+		MaxLatency = FMath::Max(MaxLatency, DrainTime - Completion.PushTime);
+		CompletionsNum++;
+		WakeUpAwaitingAction(GetActionFromSlot(Completion.Handle));
+	}
+
+	if (CompletionsNum > 0)
+	{
+		LastCompletionLatency = MaxLatency;
+	}
+
+#if STATS
+	SET_DWORD_STAT(STAT_ECF_CompletionsCount, CompletionsNum);
+	SET_FLOAT_STAT(STAT_ECF_CompletionLatency, MaxLatency * 1000.0);
+#endif
+}
+
+FECFHandle UECFSubsystem::AllocateHandle(UECFActionBase* Action)
+{
+	// The action started by a command from another thread uses the handle reserved for it.
+	if (ReservedHandleToUse.IsValid())
+	{
+		const FECFHandle ReservedHandle = ReservedHandleToUse;
+		ReservedHandleToUse.Invalidate();
+		const uint32 ReservedSlotIndex = ReservedHandle.GetSlotIndex();
+		if (IsHandleCurrent(ReservedHandle) && (Slots[ReservedSlotIndex] == nullptr) && (LightDelayIndices[ReservedSlotIndex] == INDEX_NONE))
+		{
+			Slots[ReservedSlotIndex] = Action;
+			return ReservedHandle;
+		}
+	}
+
+	uint32 SlotIndex = 0;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop();
+	}
+	else
+	{
+		if (static_cast<uint32>(Slots.Num()) >= FECFHandleGenerations::MaxSlots)
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("Can't start more ECF Actions! The limit of %u running Actions has been reached."), FECFHandleGenerations::MaxSlots);
+#endif
+			return FECFHandle();
+		}
+
+		SlotIndex = Slots.Add(nullptr);
+		LightDelayIndices.Add(INDEX_NONE);
+		Generations->SetGeneration(SlotIndex, 1);
+	}
+
+	Slots[SlotIndex] = Action;
+	return FECFHandle(SlotIndex, Generations->GetGeneration(SlotIndex));
+}
+
+void UECFSubsystem::ReleaseHandle(const FECFHandle& HandleId)
+{
+	if (IsHandleCurrent(HandleId) == false)
+	{
+		return;
+	}
+
+	const uint32 SlotIndex = HandleId.GetSlotIndex();
+	Slots[SlotIndex] = nullptr;
+	LightDelayIndices[SlotIndex] = INDEX_NONE;
+	FreeSlots.Add(SlotIndex);
+
+	// Generation 0 is reserved for slots that were never used.
+	uint32 NextGeneration = HandleId.GetGeneration() + 1;
+	if (NextGeneration == 0)
+	{
+		NextGeneration = 1;
+	}
+	Generations->SetGeneration(SlotIndex, NextGeneration);
+}
+
+UECFActionBase* UECFSubsystem::GetActionFromSlot(const FECFHandle& HandleId) const
+{
+	if (IsHandleCurrent(HandleId))
+	{
+		return Slots[HandleId.GetSlotIndex()];
+	}
+	return nullptr;
+}
+
+bool UECFSubsystem::IsHandleCurrent(const FECFHandle& HandleId) const
+{
+	const uint32 SlotIndex = HandleId.GetSlotIndex();
+	return HandleId.IsValid() && (SlotIndex < static_cast<uint32>(Slots.Num())) && (Generations->GetGeneration(SlotIndex) == HandleId.GetGeneration());
+}
+
+bool UECFSubsystem::CanUseLightDelay(const FECFActionSettings& Settings) const
+{
+	// The first delay and tick intervals require ticking the action. Light delays are finished only in the Default tick group.
+	return bUseLightDelays && (Settings.FirstDelay <= 0.f) && (Settings.TickInterval <= 0.f) && (Settings.TickGroup == EECFTickGroup::Default);
+}
+
+FECFHandle UECFSubsystem::AddLightDelay(const UObject* InOwner, const FECFActionSettings& Settings, float InDelayTime, TECFCallback<void(bool), void()>&& InCallbackFunc)
+{
+	// Ensure the Action has been started from the Game Thread.
+	if (IsInGameThread() == false)
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("ECF Actions must be started from the Game Thread!"));
+#endif
+		checkf(false, TEXT("ECF Actions must be started from the Game Thread!"));
+		return FECFHandle();
+	}
+
+	if ((InCallbackFunc.IsSet() == false) || (InDelayTime < 0.f))
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("ECF - [%s] delay failed to start. Are you sure the DelayTime is not negative and Callback Function is set properly?"), *Settings.Label);
+#endif
+		return FECFHandle();
+	}
+
+	const FECFHandle NewHandle = AllocateHandle(nullptr);
+	if (NewHandle.IsValid() == false)
+	{
+		return FECFHandle();
+	}
+
+	FECFLightDelay NewLightDelay;
+	NewLightDelay.Handle = NewHandle;
+	NewLightDelay.Owner = InOwner;
+	NewLightDelay.OwnerKey = FObjectKey(InOwner);
+	NewLightDelay.CallbackFunc = MoveTemp(InCallbackFunc);
+	NewLightDelay.Label = Settings.Label;
+	NewLightDelay.DelayTime = InDelayTime;
+	NewLightDelay.TimeLeft = InDelayTime;
+
+	// The same clock and lane as the ones used by actions.
+	NewLightDelay.ClockIndex = FindOrAddClock(Settings.Clock);
+	NewLightDelay.TimeLaneIndex = (Settings.bIgnorePause ? 1 : 0) | (Settings.bIgnoreGlobalTimeDilation ? 2 : 0);
+
+	const int32 LightDelayIndex = LightDelays.Add(MoveTemp(NewLightDelay));
+	LightDelayIndices[NewHandle.GetSlotIndex()] = LightDelayIndex;
+
+	FECFLightDelay& LightDelay = LightDelays[LightDelayIndex];
+	if (Settings.bStartPaused)
+	{
+		LightDelay.bIsPaused = true;
+	}
+	else
+	{
+		ScheduleLightDelay(LightDelay, InDelayTime);
+	}
+	RegisterOwnerHandle(InOwner, NewHandle);
+
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+	UE_LOG(LogECF, Verbose, TEXT("Started Light Delay with HandleId: %s, Label: %s"), *NewHandle.ToString(), *Settings.Label);
+#endif
+	return NewHandle;
+}
+
+FECFLightDelay* UECFSubsystem::FindLightDelay(const FECFHandle& HandleId)
+{
+	if (IsHandleCurrent(HandleId))
+	{
+		const int32 LightDelayIndex = LightDelayIndices[HandleId.GetSlotIndex()];
+		if (LightDelayIndex != INDEX_NONE)
+		{
+			return &LightDelays[LightDelayIndex];
+		}
+	}
+	return nullptr;
+}
+
+const FECFLightDelay* UECFSubsystem::FindLightDelay(const FECFHandle& HandleId) const
+{
+	return const_cast<UECFSubsystem*>(this)->FindLightDelay(HandleId);
+}
+
+TArray<FECFHandle> UECFSubsystem::GetLightDelaysOfOwner(const UObject* InOwner) const
+{
+	TArray<FECFHandle> Result;
+	if (InOwner == nullptr)
+	{
+		Result.Reserve(LightDelays.Num());
+		for (int32 LightDelayIndex = 0; LightDelayIndex < LightDelays.GetMaxIndex(); LightDelayIndex++)
+		{
+			if (LightDelays.IsAllocated(LightDelayIndex))
+			{
+				Result.Add(LightDelays[LightDelayIndex].Handle);
+			}
+		}
+	}
+	else if (const FECFOwnerActions* OwnerActions = ActionsByOwner.Find(FObjectKey(InOwner)))
+	{
+		for (const FECFHandle& OwnerActionHandle : OwnerActions->Handles)
+		{
+			if (IsHandleCurrent(OwnerActionHandle) && (LightDelayIndices[OwnerActionHandle.GetSlotIndex()] != INDEX_NONE))
+			{
+				Result.Add(OwnerActionHandle);
+			}
+		}
+	}
+	return Result;
+}
+
+void UECFSubsystem::ScheduleLightDelay(FECFLightDelay& LightDelay, float TimeLeft)
+{
+	FECFTimeLane& Lane = GetTimeLane(LightDelay.ClockIndex, LightDelay.TimeLaneIndex);
+	LightDelay.DueTime = Lane.Time + TimeLeft;
+	LightDelay.SleepId++;
+	Lane.Wheel.Schedule(LightDelay.Handle, LightDelay.SleepId, LightDelay.DueTime);
+}
+
+void UECFSubsystem::SetLightDelayPaused(FECFLightDelay& LightDelay, bool bPaused)
+{
+	if (LightDelay.bIsPaused == bPaused)
+	{
+		return;
+	}
+
+	LightDelay.bIsPaused = bPaused;
+	if (bPaused)
+	{
+		// Outdate the timer wheel entry and remember the time that is left.
+		LightDelay.TimeLeft = static_cast<float>(LightDelay.DueTime - GetTimeLane(LightDelay.ClockIndex, LightDelay.TimeLaneIndex).Time);
+		LightDelay.SleepId++;
+	}
+	else
+	{
+		ScheduleLightDelay(LightDelay, LightDelay.TimeLeft);
+	}
+}
+
+float UECFSubsystem::GetLightDelayTime(const FECFLightDelay& LightDelay) const
+{
+	const float TimeLeft = LightDelay.bIsPaused ? LightDelay.TimeLeft : static_cast<float>(LightDelay.DueTime - GetTimeLane(LightDelay.ClockIndex, LightDelay.TimeLaneIndex).Time);
+	return LightDelay.DelayTime - TimeLeft;
+}
+
+void UECFSubsystem::FinishLightDelay(FECFLightDelay& LightDelay, bool bComplete, bool bStopped)
+{
+	// The callback can add new delays, so it must be called after the delay is removed.
+	TECFCallback<void(bool), void()> CallbackFunc = MoveTemp(LightDelay.CallbackFunc);
+	RemoveLightDelay(LightDelay, true);
+	if (bComplete && CallbackFunc)
+	{
+		CallbackFunc(bStopped);
+	}
+}
+
+void UECFSubsystem::RemoveLightDelay(FECFLightDelay& LightDelay, bool bForgetOwner)
+{
+	const FECFHandle LightDelayHandle = LightDelay.Handle;
+	if (bForgetOwner)
+	{
+		if (FECFOwnerActions* OwnerActions = ActionsByOwner.Find(LightDelay.OwnerKey))
+		{
+			OwnerActions->Handles.RemoveSingleSwap(LightDelayHandle);
+		}
+	}
+
+	LightDelays.Remove(LightDelayIndices[LightDelayHandle.GetSlotIndex()]);
+	ReleaseHandle(LightDelayHandle);
+}
+
+void UECFSubsystem::FireDueLightDelays()
+{
+	// Callbacks can start, stop and reschedule light delays, so iterate through a separate buffer.
+	Swap(FiringLightDelays, DueLightDelays);
+	for (const FECFTimerWheel::FEntry& DueEntry : FiringLightDelays)
+	{
+		FECFLightDelay* LightDelay = FindLightDelay(DueEntry.Handle);
+		if ((LightDelay == nullptr) || LightDelay->bIsPaused || (LightDelay->SleepId != DueEntry.SleepId))
+		{
+			continue;
+		}
+
+		// The timer wheel can release entries a bit earlier. Keep them until the delay really passes.
+		if (GetTimeLane(LightDelay->ClockIndex, LightDelay->TimeLaneIndex).Time <= LightDelay->DueTime)
+		{
+			DueLightDelays.Add(DueEntry);
+			continue;
+		}
+
+		// Just like actions, delays of invalid owners are removed without calling their callbacks.
+		const UObject* LightDelayOwner = LightDelay->Owner.Get();
+		if (LightDelayOwner && (LightDelayOwner->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed) == false))
+		{
+			FinishLightDelay(*LightDelay, true, false);
+		}
+		else
+		{
+			RemoveLightDelay(*LightDelay, true);
+		}
+	}
+	LightDelayBuffersPeak = FMath::Max3(LightDelayBuffersPeak, FiringLightDelays.Num(), DueLightDelays.Num());
+	FiringLightDelays.Reset();
+}
+
+FECFTickContext UECFSubsystem::MakeTickContext(float DeltaTime) const
+{
+	FECFTickContext TickContext;
+	TickContext.DeltaTime = DeltaTime;
+	TickContext.DilatedDeltaTime = DeltaTime;
+	TickContext.FrameNumber = GFrameCounter;
+	if (UWorld* World = GetWorld())
+	{
+		TickContext.bIsWorldPaused = World->IsPaused();
+		TickContext.RealTime = World->GetRealTimeSeconds();
+		if (AWorldSettings* WorldSettings = World->GetWorldSettings())
+		{
+			TickContext.DilatedDeltaTime = DeltaTime * WorldSettings->TimeDilation;
+		}
+	}
+	return TickContext;
+}
+
+FECFTickContext UECFSubsystem::MakeClockTickContext(const FECFTickContext& TickContext, const FECFClock& Clock)
+{
+	FECFTickContext ClockTickContext = TickContext;
+	ClockTickContext.bIsWorldPaused = TickContext.bIsWorldPaused && (Clock.bIgnoreWorldPause == false);
+	ClockTickContext.DeltaTime = TickContext.DeltaTime * Clock.TimeScale;
+	ClockTickContext.DilatedDeltaTime = TickContext.GetDeltaTime(Clock.bIgnoreWorldTimeDilation) * Clock.TimeScale;
+	return ClockTickContext;
+}
+
+void UECFSubsystem::AdvanceTimeLanes(const FECFTickContext& TickContext)
+{
+	// New clocks can be added by actions woken up here, so don't use the ranged loop.
+	for (int32 ClockIndex = 0; ClockIndex < Clocks.Num(); ClockIndex++)
+	{
+		FECFClock& Clock = *Clocks[ClockIndex];
+		const FECFTickContext ClockTickContext = MakeClockTickContext(TickContext, Clock);
+		for (int32 LaneIndex = 0; LaneIndex < TimeLanesNum; LaneIndex++)
+		{
+			FECFTimeLane& Lane = Clock.Lanes[LaneIndex];
+			Lane.PreviousTime = Lane.Time;
+			if (Clock.bIsPaused)
+			{
+				continue;
+			}
+			AdvanceTimeLane(Lane, LaneIndex, ClockTickContext);
+		}
+	}
+}
+
+void UECFSubsystem::AdvanceTimeLane(FECFTimeLane& Lane, int32 LaneIndex, const FECFTickContext& ClockTickContext)
+{
+	// Lane indices are the same as the ones returned by UECFActionBase::GetTimeLaneIndex.
+	const bool bIgnorePause = (LaneIndex & 1) != 0;
+	const bool bIgnoreGlobalTimeDilation = (LaneIndex & 2) != 0;
+
+	if (ClockTickContext.CanTick(bIgnorePause) == false)
+	{
+		return;
+	}
+
+	Lane.Time += ClockTickContext.GetDeltaTime(bIgnoreGlobalTimeDilation);
+	Lane.Frame++;
+
+	DueSleepEntries.Reset();
+	Lane.Wheel.Advance(Lane.Time, DueSleepEntries);
+	Lane.FrameQueue.Advance(Lane.Frame, DueSleepEntries);
+	DueSleepEntriesPeak = FMath::Max(DueSleepEntriesPeak, DueSleepEntries.Num());
+	for (const FECFTimerWheel::FEntry& DueEntry : DueSleepEntries)
+	{
+		// Ignore entries of removed actions and outdated entries of actions that have been woken up earlier.
+		UECFActionBase* Action = GetActionFromSlot(DueEntry.Handle);
+		if (Action && Action->bIsSleeping && (Action->SleepId == DueEntry.SleepId))
+		{
+			// Tick the action with the time it slept until the previous frame.
+			// The time of the current frame will be applied with the regular tick.
+			SyncSleepingAction(Action, Lane.PreviousTime, Lane.Frame - 1);
+			Action->bIsSleeping = false;
+			Action->bIsAwaitingCompletion = false;
+			Action->bIsWakingUp = true;
+			WakingUpActions.Add(DueEntry.Handle);
+		}
+		else if (Action == nullptr)
+		{
+			// Light delays are validated when they are finished.
+			DueLightDelays.Add(DueEntry);
+		}
+	}
+}
+
+bool UECFSubsystem::TryPutActionToSleep(FECFActionsBucket& Bucket, int32 Index)
+{
+	UECFActionBase* Action = Bucket.Actions[Index];
+	FECFTimeLane& Lane = GetTimeLane(Action);
+
+	// Sleeping for less than one tick of the timer wheel is not worth it.
+	const float SleepTime = Action->GetAllowedSleepTime();
+	if (SleepTime >= Lane.Wheel.GetResolution())
+	{
+		Action->bIsSleepingForTicks = false;
+		Lane.Wheel.Schedule(Action->GetHandleId(), Action->SleepId + 1, Lane.Time + SleepTime);
+	}
+	else
+	{
+		// The action will skip the given number of ticks and will be ticked normally in the frame after them.
+		const int32 SleepTicks = Action->GetAllowedSleepTicks();
+		if (SleepTicks <= 0)
+		{
+			return false;
+		}
+
+		Action->bIsSleepingForTicks = true;
+		Lane.FrameQueue.Schedule(Action->GetHandleId(), Action->SleepId + 1, Lane.Frame + SleepTicks + 1);
+	}
+
+	Action->bIsSleeping = true;
+	Action->SleepId++;
+	Action->SleepLaneTime = Lane.Time;
+	Action->SleepLaneFrame = Lane.Frame;
+
+	Bucket.FallAsleep(Index);
+	return true;
+}
+
+void UECFSubsystem::WakeUpAction(UECFActionBase* Action)
+{
+	if (Action && Action->bIsSleeping)
+	{
+		// Tick the action with the whole time it slept, as it will be ticked normally from the next tick.
+		const FECFTimeLane& Lane = GetTimeLane(Action);
+		SyncSleepingAction(Action, Lane.Time, Lane.Frame);
+		Action->bIsSleeping = false;
+		Action->bIsAwaitingCompletion = false;
+		Action->bIsWakingUp = true;
+		WakingUpActions.Add(Action->GetHandleId());
+	}
+}
+
+void UECFSubsystem::WakeUpAwaitingAction(UECFActionBase* Action)
+{
+	if (Action && Action->bIsAwaitingCompletion)
+	{
+		// Actions with a timeout sleep in the timer wheel, the other ones are only kept out of the tick loop.
+		if (Action->bIsSleeping)
+		{
+			WakeUpAction(Action);
+		}
+		else
+		{
+			Action->bIsAwaitingCompletion = false;
+			Action->bIsWakingUp = true;
+			WakingUpActions.Add(Action->GetHandleId());
+		}
+	}
+}
+
+void UECFSubsystem::WakeUpDormantAction(UECFActionBase* Action)
+{
+	if (Action && Action->bIsDormant)
+	{
+		Action->bIsDormant = false;
+		Action->bIsWakingUp = true;
+		WakingUpActions.Add(Action->GetHandleId());
+	}
+}
+
+void UECFSubsystem::WakeUpRemovedAction(UECFActionBase* Action)
+{
+	WakeUpAwaitingAction(Action);
+	WakeUpAction(Action);
+	WakeUpDormantAction(Action);
+
+	// Event-only actions are never woken up by the time lanes nor resumed, so do it here.
+	// The action will be purged during the next tick, without being ticked.
+	if (Action && Action->bIsEventAction && (Action->bIsWakingUp == false))
+	{
+		Action->bIsWakingUp = true;
+		WakingUpActions.Add(Action->GetHandleId());
+	}
+}
+
+bool UECFSubsystem::HasActionsToTick() const
+{
+	if ((PendingAddActions.Num() > 0) || (WakingUpActions.Num() > 0) || (DueLightDelays.Num() > 0) || (CommandQueue->IsEmpty() == false) || (CompletionQueue->IsEmpty() == false))
+	{
+		return true;
+	}
+
+	// Actions of paused clocks don't need ticking.
+	for (const FECFActionsBucket& Bucket : ActionBuckets)
+	{
+		if ((Bucket.AwakeNum > 0) && (Clocks[Bucket.ClockIndex]->bIsPaused == false))
+		{
+			return true;
+		}
+	}
+
+	// Sleeping actions require the time lanes to advance.
+	for (const TUniquePtr<FECFClock>& Clock : Clocks)
+	{
+		if (Clock->bIsPaused)
+		{
+			continue;
+		}
+
+		for (const FECFTimeLane& Lane : Clock->Lanes)
+		{
+			if ((Lane.Wheel.Num() > 0) || (Lane.FrameQueue.Num() > 0))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool UECFSubsystem::HasActionsToTick(EECFTickGroup TickGroup) const
+{
+	for (const FECFActionsBucket& Bucket : ActionBuckets)
+	{
+		if ((Bucket.TickGroup == TickGroup) && (Bucket.Actions.Num() > 0) && (Clocks[Bucket.ClockIndex]->bIsPaused == false))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UECFSubsystem::UpdateTickFunctions()
+{
+	UWorld* World = GetWorld();
+	if ((World == nullptr) || (World->PersistentLevel == nullptr))
+	{
+		return;
+	}
+
+	// Tick functions are registered in the level of the world, so they must be registered again when the world changes.
+	if (TickFunctionsWorld.Get() != World)
+	{
+		UnregisterTickFunctions();
+	}
+
+	for (int32 TickFunctionIndex = 0; TickFunctionIndex < UE_ARRAY_COUNT(TickFunctions); TickFunctionIndex++)
+	{
+		FECFTickFunction& TickFunction = TickFunctions[TickFunctionIndex];
+		const EECFTickGroup TickGroup = static_cast<EECFTickGroup>(TickFunctionIndex + 1);
+
+		// Sleeping actions of the group can wake up at any time, so the tick function stays enabled while the group has any actions.
+		const bool bHasWork = HasActionsToTick(TickGroup);
+		if (TickFunction.IsTickFunctionRegistered() == false)
+		{
+			if (bHasWork == false)
+			{
+				continue;
+			}
+
+			static const ETickingGroup EngineTickGroups[] = { TG_PrePhysics, TG_DuringPhysics, TG_PostPhysics, TG_PostUpdateWork };
+			TickFunction.Subsystem = this;
+			TickFunction.ActionsTickGroup = TickGroup;
+			TickFunction.TickGroup = EngineTickGroups[TickFunctionIndex];
+			TickFunction.EndTickGroup = TickFunction.TickGroup;
+			TickFunction.bCanEverTick = true;
+			TickFunction.bStartWithTickEnabled = true;
+			TickFunction.bTickEvenWhenPaused = true;
+			TickFunction.RegisterTickFunction(World->PersistentLevel);
+			TickFunctionsWorld = World;
+		}
+		else if (TickFunction.IsTickFunctionEnabled() != bHasWork)
+		{
+			TickFunction.SetTickFunctionEnable(bHasWork);
+		}
+	}
+}
+
+void UECFSubsystem::UnregisterTickFunctions()
+{
+	for (FECFTickFunction& TickFunction : TickFunctions)
+	{
+		if (TickFunction.IsTickFunctionRegistered())
+		{
+			TickFunction.UnRegisterTickFunction();
+		}
+	}
+	TickFunctionsWorld.Reset();
+}
+
+void UECFSubsystem::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (World && (TickFunctionsWorld.Get() == World))
+	{
+		UnregisterTickFunctions();
+	}
+}
+
+void UECFSubsystem::SyncSleepingAction(UECFActionBase* Action, double LaneTime, uint64 LaneFrame)
+{
+	const float SleptTime = static_cast<float>(LaneTime - Action->SleepLaneTime);
+	const int32 SleptTicks = static_cast<int32>(LaneFrame - Action->SleepLaneFrame);
+	Action->SleepLaneTime = LaneTime;
+	Action->SleepLaneFrame = LaneFrame;
+	if (IsActionAlive(Action) == false)
+	{
+		return;
+	}
+
+	Action->TickLaneTime = LaneTime;
+	if (Action->bIsSleepingForTicks)
+	{
+		if (SleptTicks > 0)
+		{
+			Action->DoSkippedTicks(SleptTicks, SleptTime);
+		}
+	}
+	else if (SleptTime > 0.f)
+	{
+		Action->DoScaledTick(SleptTime);
+	}
+}
+
+void UECFSubsystem::ResetTimeLanes()
+{
+	for (const TUniquePtr<FECFClock>& Clock : Clocks)
+	{
+		for (FECFTimeLane& Lane : Clock->Lanes)
+		{
+			Lane.Time = 0.0;
+			Lane.PreviousTime = 0.0;
+			Lane.Frame = 0;
+			Lane.Wheel.Reset();
+			Lane.FrameQueue.Reset();
+		}
+	}
+	WakingUpActions.Empty();
+	DueSleepEntries.Empty();
+	ClockTickContexts.Empty();
+}
+
+uint8 UECFSubsystem::FindOrAddClock(FName ClockName)
+{
+	if (ClockName.IsNone())
+	{
+		return 0;
+	}
+
+	if (const uint8* ClockIndex = ClockIndices.Find(ClockName))
+	{
+		return *ClockIndex;
+	}
+
+	if (Clocks.Num() >= MaxClocksNum)
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("Can't add ECF clock %s, because there are too many clocks. The Gameplay clock will be used instead."), *ClockName.ToString());
+#endif
+		return 0;
+	}
+
+	const uint8 NewClockIndex = static_cast<uint8>(Clocks.Add(MakeUnique<FECFClock>()));
+	Clocks[NewClockIndex]->Name = ClockName;
+	ClockIndices.Add(ClockName, NewClockIndex);
+	return NewClockIndex;
+}
+
+void UECFSubsystem::AddDefaultClocks()
+{
+	// The Gameplay clock must be the first one, as it is used by actions which don't specify their clocks.
+	FindOrAddClock(FECFClocks::Gameplay);
+	FindOrAddClock(FECFClocks::Cinematic);
+
+	FECFClock& UIClock = *Clocks[FindOrAddClock(FECFClocks::UI)];
+	UIClock.bIgnoreWorldPause = true;
+	UIClock.bIgnoreWorldTimeDilation = true;
+
+	FECFClock& RealClock = *Clocks[FindOrAddClock(FECFClocks::Real)];
+	RealClock.bIgnoreWorldPause = true;
+	RealClock.bIgnoreWorldTimeDilation = true;
+}
+
+UECFSubsystem::FECFTimeLane& UECFSubsystem::GetTimeLane(uint8 ClockIndex, int32 LaneIndex)
+{
+	return Clocks[ClockIndex]->Lanes[LaneIndex];
+}
+
+const UECFSubsystem::FECFTimeLane& UECFSubsystem::GetTimeLane(uint8 ClockIndex, int32 LaneIndex) const
+{
+	return Clocks[ClockIndex]->Lanes[LaneIndex];
+}
+
+UECFSubsystem::FECFTimeLane& UECFSubsystem::GetTimeLane(const UECFActionBase* Action)
+{
+	return GetTimeLane(Action->ClockIndex, Action->GetTimeLaneIndex());
+}
+
+void UECFSubsystem::SetClockPaused(FName ClockName, bool bPaused)
+{
+	Clocks[FindOrAddClock(ClockName)]->bIsPaused = bPaused;
+}
+
+bool UECFSubsystem::IsClockPaused(FName ClockName) const
+{
+	const uint8* ClockIndex = ClockIndices.Find(ClockName.IsNone() ? FECFClocks::Gameplay : ClockName);
+	return ClockIndex && Clocks[*ClockIndex]->bIsPaused;
+}
+
+void UECFSubsystem::SetClockTimeScale(FName ClockName, float TimeScale)
+{
+	if (TimeScale < 0.f)
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("Can't set negative time scale of ECF clock %s!"), *ClockName.ToString());
+#endif
+		return;
+	}
+
+	Clocks[FindOrAddClock(ClockName)]->TimeScale = TimeScale;
+}
+
+float UECFSubsystem::GetClockTimeScale(FName ClockName) const
+{
+	const uint8* ClockIndex = ClockIndices.Find(ClockName.IsNone() ? FECFClocks::Gameplay : ClockName);
+	return ClockIndex ? Clocks[*ClockIndex]->TimeScale : 1.f;
+}
+
+namespace
+{
+	// Minimal capacity kept by the buffers of the subsystem, so they don't reallocate when only a few actions are running.
+	constexpr int32 MinBufferCapacity = 64;
+
+	// Shrinks the array if it uses less than a quarter of its capacity, but leaves it twice as much
+	// as it uses, so it will not reallocate again when the number of actions oscillates.
+	template<typename ArrayType>
+	void ShrinkWithHysteresis(ArrayType& Array, int32 UsedNum)
+	{
+		if ((Array.Max() > MinBufferCapacity) && (UsedNum * 4 < Array.Max()))
+		{
+			ArrayType ShrunkArray;
+			ShrunkArray.Reserve(FMath::Max(UsedNum * 2, MinBufferCapacity));
+			ShrunkArray.Append(Array);
+			Array = MoveTemp(ShrunkArray);
+		}
+	}
+}
+
+void UECFSubsystem::ShrinkBuffers()
+{
+	for (FECFActionsBucket& Bucket : ActionBuckets)
+	{
+		ShrinkWithHysteresis(Bucket.Actions, Bucket.Actions.Num());
+	}
+	ShrinkWithHysteresis(PendingAddActions, FMath::Max(PendingAddActionsPeak, PendingAddActions.Num()));
+	ShrinkWithHysteresis(WakingUpActions, FMath::Max(WakingUpActionsPeak, WakingUpActions.Num()));
+	ShrinkWithHysteresis(DueSleepEntries, DueSleepEntriesPeak);
+	ShrinkWithHysteresis(DueLightDelays, FMath::Max(LightDelayBuffersPeak, DueLightDelays.Num()));
+	ShrinkWithHysteresis(FiringLightDelays, LightDelayBuffersPeak);
+	ShrinkWithHysteresis(FreeSlots, FreeSlots.Num());
+
+	PendingAddActionsPeak = 0;
+	WakingUpActionsPeak = 0;
+	DueSleepEntriesPeak = 0;
+	LightDelayBuffersPeak = 0;
+}
+
+FECFActionsBucket& UECFSubsystem::GetActionsBucket(UECFActionBase* Action)
+{
+	FECFActionsBucketKey BucketKey;
+	BucketKey.Class = Action->GetClass();
+	BucketKey.ClockIndex = Action->ClockIndex;
+	BucketKey.bIgnorePause = Action->Settings.bIgnorePause;
+	BucketKey.TickGroup = Action->Settings.TickGroup;
+	BucketKey.Priority = Action->Settings.Priority;
+	BucketKey.bThreadSafeTick = Action->bThreadSafeTick;
+	if (const int32* BucketIndex = ActionBucketIndices.Find(BucketKey))
+	{
+		return ActionBuckets[*BucketIndex];
+	}
+
+	const int32 NewBucketIndex = ActionBuckets.AddDefaulted();
+	ActionBuckets[NewBucketIndex].Class = BucketKey.Class;
+	ActionBuckets[NewBucketIndex].ClockIndex = BucketKey.ClockIndex;
+	ActionBuckets[NewBucketIndex].bIgnorePause = BucketKey.bIgnorePause;
+	ActionBuckets[NewBucketIndex].TickGroup = BucketKey.TickGroup;
+	ActionBuckets[NewBucketIndex].Priority = BucketKey.Priority;
+	ActionBuckets[NewBucketIndex].bThreadSafeTick = BucketKey.bThreadSafeTick;
+	ActionBucketIndices.Add(BucketKey, NewBucketIndex);
+	return ActionBuckets[NewBucketIndex];
+}
+
+UECFActionBase* UECFSubsystem::TakeActionFromPool(UClass* ActionClass)
+{
+	if (FECFActionsPool* ActionsPool = ActionPools.Find(ActionClass))
+	{
+		if (ActionsPool->Actions.Num() > 0)
+		{
+			return ActionsPool->Actions.Pop();
+		}
+	}
+	return nullptr;
+}
+
+void UECFSubsystem::ReturnActionToPool(UECFActionBase* Action)
+{
+	if (bUseActionsPool == false)
+	{
+		return;
+	}
+
+	FECFActionsPool& ActionsPool = ActionPools.FindOrAdd(Action->GetClass());
+	if ((ActionsPool.Actions.Num() < MaxPooledActionsPerClass) && Action->PrepareForReuse())
+	{
+		ActionsPool.Actions.Add(Action);
+	}
+}
+
+void UECFSubsystem::PrewarmActionsPools()
+{
+	if (bUseActionsPool == false)
+	{
+		return;
+	}
+
+	for (const TPair<TSubclassOf<UECFActionBase>, int32>& PrewarmedActions : GetDefault<UECFSettings>()->PrewarmedActions)
+	{
+		UClass* ActionClass = PrewarmedActions.Key;
+		if ((ActionClass == nullptr) || ActionClass->HasAnyClassFlags(CLASS_Abstract))
+		{
+			continue;
+		}
+
+		FECFActionsPool& ActionsPool = ActionPools.FindOrAdd(ActionClass);
+		const int32 PrewarmedNum = FMath::Min(PrewarmedActions.Value, MaxPooledActionsPerClass);
+		ActionsPool.Actions.Reserve(PrewarmedNum);
+		while (ActionsPool.Actions.Num() < PrewarmedNum)
+		{
+			UECFActionBase* NewAction = NewObject<UECFActionBase>(this, ActionClass);
+			if (NewAction->PrepareForReuse() == false)
+			{
+#if ECF_LOGS
+				UE_LOG(LogECF, Warning, TEXT("Can't prewarm the pool of Actions of class %s, because this class doesn't support pooling."), *ActionClass->GetName());
+#endif
+				break;
+			}
+			ActionsPool.Actions.Add(NewAction);
+		}
+	}
+}
+
+int32 UECFSubsystem::GetActiveActionsCount() const
+{
+	int32 Result = 0;
+	for (const FECFActionsBucket& Bucket : ActionBuckets)
+	{
+		Result += Bucket.Actions.Num();
+	}
+	return Result;
+}
+
+void UECFSubsystem::RegisterActionOwner(UECFActionBase* Action)
+{
+	const UObject* ActionOwner = Action->Owner.Get();
+	if (ActionOwner == nullptr)
+	{
+		return;
+	}
+
+	Action->OwnerKey = FObjectKey(ActionOwner);
+	Action->bOwnerNotifiesTeardown = RegisterOwnerHandle(ActionOwner, Action->GetHandleId());
+}
+
+bool UECFSubsystem::RegisterOwnerHandle(const UObject* InOwner, const FECFHandle& HandleId)
+{
+	if (InOwner == nullptr)
+	{
+		return false;
+	}
+
+	FECFOwnerActions& OwnerActions = ActionsByOwner.FindOrAdd(FObjectKey(InOwner));
+	OwnerActions.Handles.Add(HandleId);
+
+	// Actors which began play will always end play before they are destroyed, so their
+	// actions can be torn down when it happens, instead of checking the owner every tick.
+	if (OwnerActions.bBoundToEndPlay == false)
+	{
+		AActor* OwnerActor = const_cast<AActor*>(Cast<AActor>(InOwner));
+		if (OwnerActor && (OwnerActor->HasActorBegunPlay() || OwnerActor->IsActorBeginningPlay()))
+		{
+			OwnerActor->OnEndPlay.AddUniqueDynamic(this, &UECFSubsystem::OnOwnerEndPlay);
+			OwnerActions.bBoundToEndPlay = true;
+		}
+	}
+	return OwnerActions.bBoundToEndPlay;
+}
+
+TArray<UECFActionBase*> UECFSubsystem::GetActionsOfOwner(const UObject* InOwner) const
+{
+	TArray<UECFActionBase*> Result;
+	if (InOwner == nullptr)
+	{
+		Result.Reserve(GetActionsCount());
+		for (const FECFActionsBucket& Bucket : ActionBuckets)
+		{
+			for (UECFActionBase* Action : Bucket.Actions)
+			{
+				if (IsActionValid(Action))
+				{
+					Result.Add(Action);
+				}
+			}
+		}
+		for (UECFActionBase* PendingAction : PendingAddActions)
+		{
+			if (IsActionValid(PendingAction))
+			{
+				Result.Add(PendingAction);
+			}
+		}
+	}
+	else if (const FECFOwnerActions* OwnerActions = ActionsByOwner.Find(FObjectKey(InOwner)))
+	{
+		Result.Reserve(OwnerActions->Handles.Num());
+		for (const FECFHandle& OwnerActionHandle : OwnerActions->Handles)
+		{
+			UECFActionBase* Action = GetActionFromSlot(OwnerActionHandle);
+			if (IsActionValid(Action))
+			{
+				Result.Add(Action);
+			}
+		}
+	}
+	return Result;
+}
+
+void UECFSubsystem::TearDownOwnerActions(const FObjectKey& InOwnerKey)
+{
+	if (FECFOwnerActions* OwnerActions = ActionsByOwner.Find(InOwnerKey))
+	{
+		for (const FECFHandle& OwnerActionHandle : OwnerActions->Handles)
+		{
+			if (UECFActionBase* Action = GetActionFromSlot(OwnerActionHandle))
+			{
+				Action->bOwnerTornDown = true;
+				WakeUpRemovedAction(Action);
+			}
+			else if (FECFLightDelay* LightDelay = FindLightDelay(OwnerActionHandle))
+			{
+				// Light delays are removed right away, the owner is forgotten below anyway.
+				RemoveLightDelay(*LightDelay, false);
+			}
+		}
+		ActionsByOwner.Remove(InOwnerKey);
+	}
+}
+
+void UECFSubsystem::OnOwnerEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+	UE_LOG(LogECF, Verbose, TEXT("Owner %s ended play, removing its Actions"), *GetNameSafe(Actor));
+#endif
+
+	if (Actor == nullptr)
+	{
+		return;
+	}
+
+	Actor->OnEndPlay.RemoveDynamic(this, &UECFSubsystem::OnOwnerEndPlay);
+	switch (EndPlayReason)
+	{
+		case EEndPlayReason::Destroyed:
+		case EEndPlayReason::LevelTransition:
+		case EEndPlayReason::EndPlayInEditor:
+		case EEndPlayReason::Quit:
+			TearDownOwnerActions(FObjectKey(Actor));
+			break;
+		case EEndPlayReason::RemovedFromWorld:
+		default:
+			// The actor can live on, e.g. in a streamed out level, so its actions go back to checking the owner
+			// every tick and are removed when it becomes invalid. Dead owners are forgotten after garbage collection.
+			ForgetOwnerTeardownNotify(FObjectKey(Actor));
+			break;
+	}
+}
+
+void UECFSubsystem::ForgetOwnerTeardownNotify(const FObjectKey& InOwnerKey)
+{
+	if (FECFOwnerActions* OwnerActions = ActionsByOwner.Find(InOwnerKey))
+	{
+		OwnerActions->bBoundToEndPlay = false;
+		for (const FECFHandle& OwnerActionHandle : OwnerActions->Handles)
+		{
+			if (UECFActionBase* Action = GetActionFromSlot(OwnerActionHandle))
+			{
+				Action->bOwnerNotifiesTeardown = false;
+			}
+		}
+	}
+}
+
+void UECFSubsystem::OnPostGarbageCollect()
+{
+	TArray<FObjectKey> OwnersToForget;
+	for (const TPair<FObjectKey, FECFOwnerActions>& OwnerActions : ActionsByOwner)
+	{
+		UObject* ActionOwner = OwnerActions.Key.ResolveObjectPtr();
+		if (ActionOwner == nullptr)
+		{
+			OwnersToForget.Add(OwnerActions.Key);
+		}
+		else if (OwnerActions.Value.Handles.Num() == 0)
+		{
+			// Forget alive owners that don't have any actions, so the map doesn't grow forever.
+			if (OwnerActions.Value.bBoundToEndPlay)
+			{
+				CastChecked<AActor>(ActionOwner)->OnEndPlay.RemoveDynamic(this, &UECFSubsystem::OnOwnerEndPlay);
+			}
+			OwnersToForget.Add(OwnerActions.Key);
+		}
+	}
+
+	for (const FObjectKey& OwnerKey : OwnersToForget)
+	{
+		TearDownOwnerActions(OwnerKey);
+	}
+}
+
+void FECFActionsBucket::AddAwake(UECFActionBase* Action)
+{
+	Action->IndexInBucket = Actions.Add(Action);
+	SwapActions(Action->IndexInBucket, AwakeNum);
+	AwakeNum++;
+}
+
+void FECFActionsBucket::AddSleeping(UECFActionBase* Action)
+{
+	Action->IndexInBucket = Actions.Add(Action);
+}
+
+void FECFActionsBucket::RemoveAwake(int32 Index)
+{
+	check(Index < AwakeNum);
+
+	// Replace the removed action with the last awake one and fill its place with the last sleeping one.
+	AwakeNum--;
+	SwapActions(Index, AwakeNum);
+	SwapActions(AwakeNum, Actions.Num() - 1);
+	Actions.Pop();
+}
+
+void FECFActionsBucket::FallAsleep(int32 Index)
+{
+	check(Index < AwakeNum);
+
+	AwakeNum--;
+	SwapActions(Index, AwakeNum);
+}
+
+void FECFActionsBucket::WakeUp(UECFActionBase* Action)
+{
+	if (Actions.IsValidIndex(Action->IndexInBucket) && (Actions[Action->IndexInBucket] == Action) && (Action->IndexInBucket >= AwakeNum))
+	{
+		SwapActions(Action->IndexInBucket, AwakeNum);
+		AwakeNum++;
+	}
+}
+
+void FECFActionsBucket::MoveToFront(int32 FirstIndex)
+{
+	// Swap the first actions with the last ones. Only as many actions as there are on the shorter side need to be swapped.
+	const int32 SwapsNum = FMath::Min(FirstIndex, AwakeNum - FirstIndex);
+	for (int32 SwapIndex = 0; SwapIndex < SwapsNum; SwapIndex++)
+	{
+		SwapActions(SwapIndex, AwakeNum - 1 - SwapIndex);
+	}
+}
+
+void FECFActionsBucket::SwapActions(int32 IndexA, int32 IndexB)
+{
+	if (IndexA == IndexB)
+	{
+		return;
+	}
+
+	Actions.Swap(IndexA, IndexB);
+	if (Actions[IndexA])
+	{
+		Actions[IndexA]->IndexInBucket = IndexA;
+	}
+	if (Actions[IndexB])
+	{
+		Actions[IndexB]->IndexInBucket = IndexB;
+	}
+}
+
 ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,115 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFTimerWheel.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+FECFTimerWheel::FECFTimerWheel(double InResolution/* = DefaultResolution*/) :
+	Resolution(InResolution)
+{
+	check(Resolution > 0.0);
+}
+
+void FECFTimerWheel::Schedule(const FECFHandle& Handle, uint32 SleepId, double DueTime)
+{
+	FEntry NewEntry;
+	NewEntry.Handle = Handle;
+	NewEntry.SleepId = SleepId;
+
+	// Entries can't be due in the current tick, as it has been already released.
+	NewEntry.DueTick = FMath::Max(TimeToTick(DueTime), CurrentTick + 1);
+
+	Insert(MoveTemp(NewEntry));
+	EntriesNum++;
+}
+
+void FECFTimerWheel::Advance(double NewTime, TArray<FEntry>& OutDueEntries)
+{
+	const uint64 NewTick = TimeToTick(NewTime);
+
+	// Nothing to release, so there is no need to visit slots one by one.
+	if (EntriesNum == 0)
+	{
+		CurrentTick = FMath::Max(CurrentTick, NewTick);
+		return;
+	}
+
+	while (CurrentTick < NewTick)
+	{
+		CurrentTick++;
+
+		// When all slots of the level have been visited, move entries of the next slot
+		// of the higher level down. Start from the highest level, so entries can fall through
+		// to the lowest level that can fit them.
+		for (int32 Level = LevelsNum - 1; Level > 0; Level--)
+		{
+			const int32 Shift = SlotBits * Level;
+			if ((CurrentTick & ((1ull << Shift) - 1)) == 0)
+			{
+				// Swap the slot with the cascade buffer instead of moving it out, so neither of them loses its memory.
+				Swap(CascadedEntries, Slots[Level][(CurrentTick >> Shift) & (SlotsNum - 1)]);
+				for (FEntry& CascadedEntry : CascadedEntries)
+				{
+					Insert(MoveTemp(CascadedEntry));
+				}
+				CascadedEntries.Reset();
+			}
+		}
+
+		TArray<FEntry>& DueSlot = Slots[0][CurrentTick & (SlotsNum - 1)];
+		if (DueSlot.Num() > 0)
+		{
+			EntriesNum -= DueSlot.Num();
+			OutDueEntries.Append(DueSlot);
+			DueSlot.Reset();
+
+			if (EntriesNum == 0)
+			{
+				CurrentTick = NewTick;
+			}
+		}
+	}
+}
+
+void FECFTimerWheel::Reset()
+{
+	for (int32 Level = 0; Level < LevelsNum; Level++)
+	{
+		for (int32 SlotIndex = 0; SlotIndex < SlotsNum; SlotIndex++)
+		{
+			Slots[Level][SlotIndex].Empty();
+		}
+	}
+	CascadedEntries.Empty();
+	CurrentTick = 0;
+	EntriesNum = 0;
+}
+
+void FECFTimerWheel::Insert(FEntry&& Entry)
+{
+	const uint64 TicksLeft = (Entry.DueTick > CurrentTick) ? (Entry.DueTick - CurrentTick) : 0;
+
+	for (int32 Level = 0; Level < LevelsNum; Level++)
+	{
+		const int32 Shift = SlotBits * Level;
+		if (TicksLeft < (1ull << (Shift + SlotBits)))
+		{
+			const uint64 SlotTick = FMath::Max(Entry.DueTick, CurrentTick);
+			Slots[Level][(SlotTick >> Shift) & (SlotsNum - 1)].Add(MoveTemp(Entry));
+			return;
+		}
+	}
+
+	// Entry is due further than the wheel can handle. Keep it in the furthest slot
+	// of the highest level. It will be rescheduled when the wheel reaches this slot.
+	const int32 Shift = SlotBits * (LevelsNum - 1);
+	const uint64 FurthestTick = CurrentTick + (1ull << (SlotBits * LevelsNum)) - 1;
+	Slots[LevelsNum - 1][(FurthestTick >> Shift) & (SlotsNum - 1)].Add(MoveTemp(Entry));
+}
+
+uint64 FECFTimerWheel::TimeToTick(double Time) const
+{
+	return (Time > 0.0) ? static_cast<uint64>(Time / Resolution) : 0;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
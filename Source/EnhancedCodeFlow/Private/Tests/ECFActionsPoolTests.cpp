@@ -0,0 +1,100 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectArray.h"
+#include "EnhancedCodeFlow.h"
+#include "ECFSettings.h"
+#include "ECFTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFActionsPoolTests
+{
+	constexpr int32 MaxActionsNum = 256;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	struct FRoundResult
+	{
+		FECFTestMeasurement Start;
+		int32 ReusedActionsNum = 0;
+		int32 CreatedActionsNum = 0;
+		int32 CompletedActionsNum = 0;
+	};
+
+	// Starts short tickers and ticks them until they end, so they go back to the pool.
+	FRoundResult RunRound(FECFTestWorld& TestWorld, int32 ActionsNum)
+	{
+		FRoundResult Result;
+		UWorld* World = TestWorld.GetWorld();
+		const FECFActionsPoolStats StatsBefore = FFlow::GetActionsPoolStats(World);
+
+		Result.Start = ECFTests::Measure([World, ActionsNum, &Result]()
+		{
+			for (int32 ActionIndex = 0; ActionIndex < ActionsNum; ActionIndex++)
+			{
+				FFlow::AddTicker(World, 0.05f, [](float TickDeltaTime) {}, [&Result]() { Result.CompletedActionsNum++; });
+			}
+		});
+
+		TestWorld.TickFrames(10, DeltaTime);
+
+		const FECFActionsPoolStats StatsAfter = FFlow::GetActionsPoolStats(World);
+		Result.ReusedActionsNum = StatsAfter.ReusedActionsNum - StatsBefore.ReusedActionsNum;
+		Result.CreatedActionsNum = StatsAfter.CreatedActionsNum - StatsBefore.CreatedActionsNum;
+		return Result;
+	}
+
+	FString DescribeRound(const TCHAR* RoundName, const FRoundResult& Result, int32 ActionsNum)
+	{
+		return FString::Printf(TEXT("%s: %d actions, %d reused, %d created, start: %s"),
+			RoundName, ActionsNum, Result.ReusedActionsNum, Result.CreatedActionsNum, *Result.Start.ToString());
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFActionsPoolReuseTest, "EnhancedCodeFlow.ActionsPool.ReuseFinishedActions", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFActionsPoolReuseTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFActionsPoolTests;
+
+	// The subsystem reads the settings when it is initialized, so they are changed before the world is created
+	// and restored when the test ends.
+	UECFSettings* ECFSettings = GetMutableDefault<UECFSettings>();
+	TGuardValue<bool> UseActionsPoolGuard(ECFSettings->bUseActionsPool, true);
+	TGuardValue<int32> MaxPooledActionsGuard(ECFSettings->MaxPooledActionsPerClass, MaxActionsNum);
+
+	const int32 ActionsNum = MaxActionsNum;
+	FECFTestWorld TestWorld;
+
+	// The first round fills the pool, the second one should take all actions from it.
+	const FRoundResult ColdResult = RunRound(TestWorld, ActionsNum);
+	const FRoundResult WarmResult = RunRound(TestWorld, ActionsNum);
+
+	TestEqual(TEXT("All actions of the first round have been completed"), ColdResult.CompletedActionsNum, ActionsNum);
+	TestEqual(TEXT("All actions of the second round have been completed"), WarmResult.CompletedActionsNum, ActionsNum);
+	TestEqual(TEXT("All actions of the second round have been reused"), WarmResult.ReusedActionsNum, ActionsNum);
+	TestEqual(TEXT("No actions of the second round have been created"), WarmResult.CreatedActionsNum, 0);
+	TestEqual(TEXT("No UObjects have been created in the second round"), WarmResult.Start.CreatedObjectsNum, 0);
+	TestTrue(TEXT("Reused actions allocate less than created ones"), WarmResult.Start.AllocatedBytes < ColdResult.Start.AllocatedBytes || ColdResult.CreatedActionsNum == 0);
+	TestTrue(TEXT("Finished actions are kept in the pool"), FFlow::GetActionsPoolStats(TestWorld.GetWorld()).PooledActionsNum >= ActionsNum);
+
+	AddInfo(DescribeRound(TEXT("First round"), ColdResult, ActionsNum));
+	AddInfo(DescribeRound(TEXT("Second round"), WarmResult, ActionsNum));
+
+	// Pooled actions are referenced by the subsystem, so the garbage collector has nothing of them to reclaim.
+	const int32 ObjectsNumBeforeGC = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	const double GCStartTime = FPlatformTime::Seconds();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const double GCTime = FPlatformTime::Seconds() - GCStartTime;
+	AddInfo(FString::Printf(TEXT("Garbage collection: %.2f ms, %d UObjects reclaimed"), GCTime * 1000.0, ObjectsNumBeforeGC - GUObjectArray.GetObjectArrayNumMinusAvailable()));
+	TestTrue(TEXT("Pooled actions survive garbage collection"), FFlow::GetActionsPoolStats(TestWorld.GetWorld()).PooledActionsNum >= ActionsNum);
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
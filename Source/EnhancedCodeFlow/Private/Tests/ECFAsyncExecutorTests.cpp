@@ -0,0 +1,205 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ECFAsyncTask.h"
+#include "ECFSettings.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFAsyncExecutorTests
+{
+	constexpr int32 MaxTasksNum = 8;
+	constexpr double TimeoutSeconds = 10.0;
+
+	// State shared with the tasks, so it outlives them even if the test times out.
+	struct FTasksRecord
+	{
+		FTasksRecord()
+		{
+			for (int32 TaskIndex = 0; TaskIndex < MaxTasksNum; TaskIndex++)
+			{
+				Orders[TaskIndex] = INDEX_NONE;
+			}
+		}
+
+		// Records the start of the given task.
+		void Start(int32 TaskIndex)
+		{
+			Orders[TaskIndex] = NextOrder++;
+		}
+
+		// Blocks the worker thread until the gate is opened or the time runs out.
+		void WaitForGate() const
+		{
+			const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+			while ((bIsGateOpen == false) && (FPlatformTime::Seconds() < EndTime))
+			{
+				FPlatformProcess::Sleep(0.001f);
+			}
+		}
+
+		std::atomic<int32> NextOrder { 0 };
+		std::atomic<int32> Orders[MaxTasksNum];
+		std::atomic<bool> bIsGateOpen { false };
+	};
+
+	using FTasksRecordRef = TSharedRef<FTasksRecord, ESPMode::ThreadSafe>;
+
+	template<typename ConditionType>
+	bool WaitUntil(const ConditionType& Condition)
+	{
+		const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+		while (Condition() == false)
+		{
+			if (FPlatformTime::Seconds() > EndTime)
+			{
+				return false;
+			}
+			FPlatformProcess::Sleep(0.001f);
+		}
+		return true;
+	}
+
+	// Sets the limit of tasks in flight for the test and restores the one from the project settings after it.
+	struct FScopedMaxTasksInFlight
+	{
+		FScopedMaxTasksInFlight(int32 MaxTasksInFlight)
+		{
+			FECFAsyncTask::SetMaxTasksInFlight(MaxTasksInFlight);
+		}
+
+		~FScopedMaxTasksInFlight()
+		{
+			FECFAsyncTask::SetMaxTasksInFlight(GetDefault<UECFSettings>()->MaxAsyncTasksInFlight);
+		}
+	};
+
+	bool IsExecutorIdle()
+	{
+		const FECFAsyncExecutorStats Stats = FECFAsyncTask::GetExecutorStats();
+		return (Stats.QueuedTasksNum == 0) && (Stats.TasksInFlightNum == 0);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFAsyncExecutorQueueTest, "EnhancedCodeFlow.AsyncExecutor.Queue", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFAsyncExecutorQueueTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFAsyncExecutorTests;
+
+	FScopedMaxTasksInFlight MaxTasksInFlight(1);
+	FTasksRecordRef Record = MakeShared<FTasksRecord, ESPMode::ThreadSafe>();
+
+	// The blocking task takes the only slot, so the next tasks wait in the queues of their priorities.
+	FECFAsyncTask BlockingTask;
+	BlockingTask.Launch([Record]() { Record->WaitForGate(); }, EECFAsyncPrio::Normal);
+
+	const EECFAsyncPrio Priorities[] = { EECFAsyncPrio::Normal, EECFAsyncPrio::LowPriority, EECFAsyncPrio::Normal, EECFAsyncPrio::HiPriority, EECFAsyncPrio::Foreground };
+	constexpr int32 QueuedTasksNum = UE_ARRAY_COUNT(Priorities);
+	FECFAsyncTask QueuedTasks[QueuedTasksNum];
+	for (int32 TaskIndex = 0; TaskIndex < QueuedTasksNum; TaskIndex++)
+	{
+		QueuedTasks[TaskIndex].Launch([Record, TaskIndex]() { Record->Start(TaskIndex); }, Priorities[TaskIndex]);
+	}
+
+	const FECFAsyncExecutorStats QueuedStats = FECFAsyncTask::GetExecutorStats();
+	TestEqual(TEXT("Tasks above the limit are queued"), QueuedStats.QueuedTasksNum, QueuedTasksNum);
+	TestEqual(TEXT("Only one task is in flight"), QueuedStats.TasksInFlightNum, 1);
+	TestTrue(TEXT("Blocking task has started"), BlockingTask.IsStarted());
+	for (int32 TaskIndex = 0; TaskIndex < QueuedTasksNum; TaskIndex++)
+	{
+		TestFalse(FString::Printf(TEXT("Queued task %d hasn't started"), TaskIndex), QueuedTasks[TaskIndex].IsStarted());
+	}
+
+	Record->bIsGateOpen = true;
+	TestTrue(TEXT("All queued tasks have ended"), WaitUntil([&QueuedTasks]()
+	{
+		for (const FECFAsyncTask& QueuedTask : QueuedTasks)
+		{
+			if (QueuedTask.IsDone() == false)
+			{
+				return false;
+			}
+		}
+		return true;
+	}));
+
+	// Higher priorities go first and tasks of the same priority keep the order they have been launched in.
+	const int32 ExpectedOrders[] = { 2, 4, 3, 1, 0 };
+	for (int32 TaskIndex = 0; TaskIndex < QueuedTasksNum; TaskIndex++)
+	{
+		TestEqual(FString::Printf(TEXT("Start order of queued task %d"), TaskIndex), Record->Orders[TaskIndex].load(), ExpectedOrders[TaskIndex]);
+	}
+
+	TestTrue(TEXT("Executor is idle after all tasks"), WaitUntil(&IsExecutorIdle));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFAsyncExecutorCancelQueuedTest, "EnhancedCodeFlow.AsyncExecutor.CancelQueued", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFAsyncExecutorCancelQueuedTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFAsyncExecutorTests;
+
+	FScopedMaxTasksInFlight MaxTasksInFlight(1);
+	FTasksRecordRef Record = MakeShared<FTasksRecord, ESPMode::ThreadSafe>();
+
+	FECFAsyncTask BlockingTask;
+	BlockingTask.Launch([Record]() { Record->WaitForGate(); }, EECFAsyncPrio::Normal);
+
+	// The canceled task leaves the queue without calling its function and without taking the slot.
+	FECFAsyncTask CanceledTask;
+	CanceledTask.Launch([Record]() { Record->Start(0); }, EECFAsyncPrio::Normal);
+	FECFAsyncTask NextTask;
+	NextTask.Launch([Record]() { Record->Start(1); }, EECFAsyncPrio::Normal);
+	CanceledTask.Cancel();
+	TestFalse(TEXT("Canceled task is not done while it waits in the queue"), CanceledTask.IsDone());
+
+	Record->bIsGateOpen = true;
+	TestTrue(TEXT("Canceled task has ended"), WaitUntil([&CanceledTask]() { return CanceledTask.IsDone(); }));
+	TestTrue(TEXT("Task after the canceled one has ended"), WaitUntil([&NextTask]() { return NextTask.IsDone(); }));
+	TestEqual(TEXT("Function of the canceled task hasn't been called"), Record->Orders[0].load(), static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("Task after the canceled one has been called"), Record->Orders[1].load(), 0);
+	TestTrue(TEXT("Executor is idle after all tasks"), WaitUntil(&IsExecutorIdle));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFAsyncExecutorPipesTest, "EnhancedCodeFlow.AsyncExecutor.Pipes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFAsyncExecutorPipesTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFAsyncExecutorTests;
+
+	FScopedMaxTasksInFlight MaxTasksInFlight(2);
+	FTasksRecordRef Record = MakeShared<FTasksRecord, ESPMode::ThreadSafe>();
+
+	// The first task of the pipe blocks it. The next task of the pipe waits for it without taking the second slot,
+	// so the task outside of the pipe can use it.
+	const FECFAsyncPipe TestPipe(TEXT("ECFTestPipe"));
+	FECFAsyncTask BlockingPipeTask;
+	BlockingPipeTask.Launch([Record]() { Record->Start(0); Record->WaitForGate(); }, EECFAsyncPrio::Normal, TestPipe);
+	FECFAsyncTask WaitingPipeTask;
+	WaitingPipeTask.Launch([Record]() { Record->Start(1); }, EECFAsyncPrio::Normal, TestPipe);
+	FECFAsyncTask FreeTask;
+	FreeTask.Launch([Record]() { Record->Start(2); }, EECFAsyncPrio::Normal);
+
+	TestTrue(TEXT("Task outside of the blocked pipe has ended"), WaitUntil([&FreeTask]() { return FreeTask.IsDone(); }));
+	TestFalse(TEXT("Waiting task of the blocked pipe hasn't started"), WaitingPipeTask.IsStarted());
+
+	Record->bIsGateOpen = true;
+	TestTrue(TEXT("Waiting task of the pipe has ended"), WaitUntil([&WaitingPipeTask]() { return WaitingPipeTask.IsDone(); }));
+	TestTrue(TEXT("Tasks of the pipe run in the order they have been launched"), Record->Orders[1] > Record->Orders[0]);
+	TestTrue(TEXT("Executor is idle after all tasks"), WaitUntil(&IsExecutorIdle));
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
@@ -0,0 +1,223 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ECFAsyncPipeline.h"
+#include "ECFSettings.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFAsyncPipelineTests
+{
+	constexpr int32 MaxStagesNum = 8;
+	constexpr double TimeoutSeconds = 10.0;
+
+	// What stages have done. Shared with the stages, so it outlives them even if the test times out.
+	struct FStagesRecord
+	{
+		FStagesRecord()
+		{
+			for (int32 StageIndex = 0; StageIndex < MaxStagesNum; StageIndex++)
+			{
+				Orders[StageIndex] = INDEX_NONE;
+				RunsNum[StageIndex] = 0;
+			}
+		}
+
+		// Records the run of the given stage and returns its order among all runs.
+		int32 Run(int32 StageIndex)
+		{
+			RunsNum[StageIndex]++;
+			const int32 Order = NextOrder++;
+			Orders[StageIndex] = Order;
+			return Order;
+		}
+
+		std::atomic<int32> NextOrder { 0 };
+		std::atomic<int32> Orders[MaxStagesNum];
+		std::atomic<int32> RunsNum[MaxStagesNum];
+	};
+
+	using FStagesRecordRef = TSharedRef<FStagesRecord, ESPMode::ThreadSafe>;
+
+	bool WaitUntilDone(const FECFAsyncTask& Task)
+	{
+		const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+		while (Task.IsDone() == false)
+		{
+			if (FPlatformTime::Seconds() > EndTime)
+			{
+				return false;
+			}
+			FPlatformProcess::Sleep(0.001f);
+		}
+		return true;
+	}
+
+	// Waits on a worker thread until the given condition is met or the time runs out.
+	template<typename ConditionType>
+	bool WaitOnWorker(const ConditionType& Condition)
+	{
+		const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+		while (Condition() == false)
+		{
+			if (FPlatformTime::Seconds() > EndTime)
+			{
+				return false;
+			}
+			FPlatformProcess::Sleep(0.001f);
+		}
+		return true;
+	}
+
+	// Stages wait for each other, so they need enough slots of the executor to run at the same time.
+	struct FScopedUnlimitedExecutor
+	{
+		FScopedUnlimitedExecutor()
+		{
+			FECFAsyncTask::SetMaxTasksInFlight(0);
+		}
+
+		~FScopedUnlimitedExecutor()
+		{
+			FECFAsyncTask::SetMaxTasksInFlight(GetDefault<UECFSettings>()->MaxAsyncTasksInFlight);
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFAsyncPipelineWhenAllTest, "EnhancedCodeFlow.AsyncPipeline.WhenAll", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFAsyncPipelineWhenAllTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFAsyncPipelineTests;
+
+	FScopedUnlimitedExecutor UnlimitedExecutor;
+	FStagesRecordRef Record = MakeShared<FStagesRecord, ESPMode::ThreadSafe>();
+
+	// Three parallel stages joined by one, followed by the last one. The joining stage lists one prerequisite twice.
+	FECFAsyncPipeline Pipeline;
+	const int32 FirstStage = Pipeline.Add([Record]() { Record->Run(0); });
+	const int32 SecondStage = Pipeline.Add([Record]() { Record->Run(1); });
+	const int32 ThirdStage = Pipeline.Add([Record]() { FPlatformProcess::Sleep(0.01f); Record->Run(2); });
+	const int32 JoinStage = Pipeline.WhenAll({ FirstStage, SecondStage, ThirdStage, ThirdStage }, [Record]() { Record->Run(3); });
+	Pipeline.Then(JoinStage, [Record]() { Record->Run(4); });
+	TestTrue(TEXT("Pipeline is valid"), Pipeline.IsValid());
+
+	FECFAsyncTask Task;
+	TestTrue(TEXT("Pipeline has been launched"), Task.Launch(MoveTemp(Pipeline), EECFAsyncPrio::Normal));
+	TestTrue(TEXT("Pipeline has ended"), WaitUntilDone(Task));
+
+	for (int32 StageIndex = 0; StageIndex < 5; StageIndex++)
+	{
+		TestEqual(FString::Printf(TEXT("Stage %d has run once"), StageIndex), Record->RunsNum[StageIndex].load(), 1);
+	}
+
+	const int32 JoinOrder = Record->Orders[3];
+	TestTrue(TEXT("Joining stage runs after all of its prerequisites"), (JoinOrder > Record->Orders[0]) && (JoinOrder > Record->Orders[1]) && (JoinOrder > Record->Orders[2]));
+	TestTrue(TEXT("Next stage runs after the joining one"), Record->Orders[4] > JoinOrder);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFAsyncPipelineWhenAnyTest, "EnhancedCodeFlow.AsyncPipeline.WhenAny", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFAsyncPipelineWhenAnyTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFAsyncPipelineTests;
+
+	FScopedUnlimitedExecutor UnlimitedExecutor;
+	FStagesRecordRef Record = MakeShared<FStagesRecord, ESPMode::ThreadSafe>();
+	TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe> bSlowStageWaited = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+
+	// The slow stage ends only after the WhenAny stage has run, so the WhenAny stage can't wait for it.
+	FECFAsyncPipeline Pipeline;
+	const int32 FastStage = Pipeline.Add([Record]() { Record->Run(0); });
+	const int32 SlowStage = Pipeline.Add([Record, bSlowStageWaited]()
+	{
+		*bSlowStageWaited = WaitOnWorker([Record]() { return Record->RunsNum[2] > 0; });
+		Record->Run(1);
+	});
+	Pipeline.WhenAny({ FastStage, SlowStage }, [Record]() { Record->Run(2); });
+
+	FECFAsyncTask Task;
+	TestTrue(TEXT("Pipeline has been launched"), Task.Launch(MoveTemp(Pipeline), EECFAsyncPrio::Normal));
+	TestTrue(TEXT("Pipeline has ended"), WaitUntilDone(Task));
+
+	TestTrue(TEXT("WhenAny stage has run before the slow prerequisite ended"), bSlowStageWaited->load());
+	TestEqual(TEXT("WhenAny stage has run once"), Record->RunsNum[2].load(), 1);
+	TestTrue(TEXT("WhenAny stage runs after the fast prerequisite"), Record->Orders[2] > Record->Orders[0]);
+	TestEqual(TEXT("Slow stage has run"), Record->RunsNum[1].load(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFAsyncPipelineCancelTest, "EnhancedCodeFlow.AsyncPipeline.Cancel", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFAsyncPipelineCancelTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFAsyncPipelineTests;
+
+	FScopedUnlimitedExecutor UnlimitedExecutor;
+	FStagesRecordRef Record = MakeShared<FStagesRecord, ESPMode::ThreadSafe>();
+
+	// The first stage runs until it is canceled. Stages after it are only counted, so the pipeline still ends.
+	FECFAsyncPipeline Pipeline;
+	const int32 CanceledStage = Pipeline.Add([Record](const FECFCancellationToken& CancellationToken)
+	{
+		Record->Run(0);
+		WaitOnWorker([&CancellationToken]() { return CancellationToken.IsCanceled(); });
+	});
+	const int32 NextStage = Pipeline.Then(CanceledStage, [Record]() { Record->Run(1); });
+	Pipeline.WhenAny({ NextStage }, [Record]() { Record->Run(2); });
+
+	FECFAsyncTask Task;
+	TestTrue(TEXT("Pipeline has been launched"), Task.Launch(MoveTemp(Pipeline), EECFAsyncPrio::Normal));
+
+	const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+	while ((Record->RunsNum[0] == 0) && (FPlatformTime::Seconds() < EndTime))
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+	Task.Cancel();
+
+	TestTrue(TEXT("Canceled pipeline has ended"), WaitUntilDone(Task));
+	TestEqual(TEXT("Stage after the canceled one hasn't run"), Record->RunsNum[1].load(), 0);
+	TestEqual(TEXT("WhenAny stage after the canceled one hasn't run"), Record->RunsNum[2].load(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFAsyncPipelineInvalidStagesTest, "EnhancedCodeFlow.AsyncPipeline.InvalidStages", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFAsyncPipelineInvalidStagesTest::RunTest(const FString& Parameters)
+{
+#if ECF_LOGS
+	AddExpectedError(TEXT("has invalid prerequisite"), EAutomationExpectedErrorFlags::Contains, 1);
+	AddExpectedError(TEXT("waits for any of no prerequisites"), EAutomationExpectedErrorFlags::Contains, 1);
+#endif
+
+	FECFAsyncTask Task;
+
+	// Prerequisites must be added before their stages.
+	FECFAsyncPipeline ForwardPipeline;
+	const int32 FirstStage = ForwardPipeline.Add([]() {});
+	TestEqual(TEXT("Stage with a later prerequisite is not added"), ForwardPipeline.Then(FirstStage + 1, []() {}), static_cast<int32>(INDEX_NONE));
+	TestFalse(TEXT("Pipeline with a later prerequisite is invalid"), ForwardPipeline.IsValid());
+	TestFalse(TEXT("Invalid pipeline is not launched"), Task.Launch(MoveTemp(ForwardPipeline), EECFAsyncPrio::Normal));
+
+	FECFAsyncPipeline EmptyWhenAnyPipeline;
+	TestEqual(TEXT("WhenAny stage without prerequisites is not added"), EmptyWhenAnyPipeline.WhenAny({}, []() {}), static_cast<int32>(INDEX_NONE));
+	TestFalse(TEXT("Pipeline with WhenAny stage without prerequisites is invalid"), EmptyWhenAnyPipeline.IsValid());
+
+	FECFAsyncPipeline EmptyPipeline;
+	TestFalse(TEXT("Pipeline without stages is invalid"), EmptyPipeline.IsValid());
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
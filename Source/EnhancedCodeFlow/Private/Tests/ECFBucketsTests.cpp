@@ -0,0 +1,160 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EnhancedCodeFlow.h"
+#include "ECFSettings.h"
+#include "CodeFlowActions/ECFTimeline.h"
+#include "ECFTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFBucketsTests
+{
+	constexpr int32 LoadActionsNum = 10000;
+	constexpr int32 LoadKindsNum = 5;
+	constexpr int32 QueriesNum = 100;
+	constexpr int32 MeasuredFramesNum = 60;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	// Starts a mixed load of actions, interleaving their classes like gameplay code does: tickers, timelines and waits
+	// ticked every frame, interval tickers woken up from time to time and long delays sleeping all the time.
+	void StartMixedLoad(UWorld* World)
+	{
+		for (int32 ActionIndex = 0; ActionIndex < LoadActionsNum; ActionIndex++)
+		{
+			switch (ActionIndex % LoadKindsNum)
+			{
+				case 0:
+					FFlow::AddTicker(World, [](float TickDeltaTime) {});
+					break;
+				case 1:
+					FFlow::AddTimeline(World, 0.f, 1.f, 3600.f, [](float Value, float Time) {});
+					break;
+				case 2:
+					FFlow::WaitAndExecute(World, [](float WaitDeltaTime) { return false; }, []() {});
+					break;
+				case 3:
+					FFlow::AddTicker(World, [](float TickDeltaTime) {}, nullptr, ECF_TICKINTERVAL(0.5f));
+					break;
+				default:
+					FFlow::Delay(World, 600.f, []() {});
+					break;
+			}
+		}
+	}
+
+	// Finds timelines the way class queries did before buckets: by checking the class of every action.
+	TArray<FECFHandle> FindTimelinesByScan(const TArray<UECFActionBase*>& AllActions)
+	{
+		TArray<FECFHandle> Handles;
+		for (UECFActionBase* Action : AllActions)
+		{
+			if (Action && Action->IsA(UECFTimeline::StaticClass()))
+			{
+				Handles.Add(Action->GetHandleId());
+			}
+		}
+		return Handles;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFBucketsMixedLoadTest, "EnhancedCodeFlow.Buckets.MixedLoad", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFBucketsMixedLoadTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFBucketsTests;
+
+	// All delays of the load are kept as actions, so all of them are in buckets.
+	TGuardValue<bool> UseLightDelaysGuard(GetMutableDefault<UECFSettings>()->bUseLightDelays, false);
+	constexpr int32 TimelinesNum = LoadActionsNum / LoadKindsNum;
+
+	// Class queries.
+	{
+		FECFTestWorld TestWorld;
+		UWorld* World = TestWorld.GetWorld();
+		StartMixedLoad(World);
+		TestWorld.TickFrames(2, DeltaTime);
+
+		const TArray<UECFActionBase*> AllActions = FFlow::GetAllActions(World);
+		int32 ScannedTimelinesNum = 0;
+		const FECFTestMeasurement ScanMeasurement = ECFTests::Measure([&AllActions, &ScannedTimelinesNum]()
+		{
+			for (int32 QueryIndex = 0; QueryIndex < QueriesNum; QueryIndex++)
+			{
+				ScannedTimelinesNum = FindTimelinesByScan(AllActions).Num();
+			}
+		});
+
+		int32 BucketTimelinesNum = 0;
+		const FECFTestMeasurement BucketsMeasurement = ECFTests::Measure([World, &BucketTimelinesNum]()
+		{
+			for (int32 QueryIndex = 0; QueryIndex < QueriesNum; QueryIndex++)
+			{
+				BucketTimelinesNum = FFlow::GetActionsHandlesByClass<UECFTimeline>(World).Num();
+			}
+		});
+
+		TestEqual(TEXT("Scan finds all timelines"), ScannedTimelinesNum, TimelinesNum);
+		TestEqual(TEXT("Buckets find all timelines"), BucketTimelinesNum, TimelinesNum);
+		AddInfo(FString::Printf(TEXT("Query of %d timelines among %d actions: scan %.1f us, buckets %.1f us"), TimelinesNum, LoadActionsNum,
+			ScanMeasurement.Time * 1e6 / QueriesNum, BucketsMeasurement.Time * 1e6 / QueriesNum));
+	}
+
+	// Stopping all actions of a class. Stopped actions are gone, so every way of stopping gets its own load.
+	{
+		FECFTestMeasurement ScanMeasurement;
+		{
+			FECFTestWorld TestWorld;
+			UWorld* World = TestWorld.GetWorld();
+			StartMixedLoad(World);
+			TestWorld.TickFrames(2, DeltaTime);
+
+			const TArray<UECFActionBase*> AllActions = FFlow::GetAllActions(World);
+			ScanMeasurement = ECFTests::Measure([World, &AllActions]()
+			{
+				for (FECFHandle& Handle : FindTimelinesByScan(AllActions))
+				{
+					FFlow::StopAction(World, Handle);
+				}
+			});
+			TestWorld.Tick(DeltaTime);
+			TestEqual(TEXT("Scan stops all timelines"), FFlow::GetActionsHandlesByClass<UECFTimeline>(World).Num(), 0);
+		}
+
+		FECFTestMeasurement BucketsMeasurement;
+		{
+			FECFTestWorld TestWorld;
+			UWorld* World = TestWorld.GetWorld();
+			StartMixedLoad(World);
+			TestWorld.TickFrames(2, DeltaTime);
+
+			BucketsMeasurement = ECFTests::Measure([World]() { FFlow::StopAllActionsOfClass<UECFTimeline>(World); });
+			TestWorld.Tick(DeltaTime);
+			TestEqual(TEXT("Buckets stop all timelines"), FFlow::GetActionsHandlesByClass<UECFTimeline>(World).Num(), 0);
+		}
+
+		AddInfo(FString::Printf(TEXT("Stopping %d timelines among %d actions: scan %.1f us, buckets %.1f us"), TimelinesNum, LoadActionsNum,
+			ScanMeasurement.Time * 1e6, BucketsMeasurement.Time * 1e6));
+	}
+
+	// Ticking the load. Actions are ticked one class at a time and sleeping ones are not visited.
+	{
+		FECFTestWorld TestWorld;
+		StartMixedLoad(TestWorld.GetWorld());
+		TestWorld.TickFrames(2, DeltaTime);
+
+		const FECFTestMeasurement TickMeasurement = ECFTests::Measure([&TestWorld]() { TestWorld.TickFrames(MeasuredFramesNum, DeltaTime); });
+		AddInfo(FString::Printf(TEXT("Tick of %d mixed actions: %.3f ms per frame, %.1f ns per action, %d frames: %s"), LoadActionsNum,
+			TickMeasurement.Time * 1000.0 / MeasuredFramesNum, TickMeasurement.Time * 1e9 / (MeasuredFramesNum * LoadActionsNum),
+			MeasuredFramesNum, *TickMeasurement.ToString()));
+	}
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
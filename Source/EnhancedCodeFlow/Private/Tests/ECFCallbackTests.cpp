@@ -0,0 +1,122 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/TVariant.h"
+#include "ECFCallback.h"
+#include "ECFHandle.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFCallbackTests
+{
+	constexpr int32 CallsNum = 100000;
+
+	// Measures the callback of one action given as its usual lambda: before, when callbacks kept TUniqueFunction
+	// in a variant, and after, with the function kept inline.
+	template<typename CallbackType, typename OldFuncType, typename FuncType, typename... ArgTypes>
+	void MeasureCallback(FAutomationTestBase& Test, const TCHAR* ActionName, const FuncType& Func, ArgTypes... Args)
+	{
+		using FOldStorage = TVariant<FEmptyVariantState, OldFuncType>;
+
+		int32 OldAllocationsNum = 0;
+		double OldCallTime = 0.0;
+		{
+			FOldStorage OldStorage;
+			OldAllocationsNum = ECFTests::Measure([&OldStorage, &Func]() { OldStorage.template Emplace<OldFuncType>(Func); }).AllocationsNum;
+
+			const OldFuncType& OldFunc = OldStorage.template Get<OldFuncType>();
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 CallIndex = 0; CallIndex < CallsNum; CallIndex++)
+			{
+				OldFunc(Args...);
+			}
+			OldCallTime = FPlatformTime::Seconds() - StartTime;
+		}
+
+		int32 NewAllocationsNum = 0;
+		double NewCallTime = 0.0;
+		{
+			CallbackType Callback;
+			NewAllocationsNum = ECFTests::Measure([&Callback, &Func]() { Callback.Set(FuncType(Func)); }).AllocationsNum;
+
+			Test.TestTrue(FString::Printf(TEXT("%s callback is kept inline"), ActionName), Callback.IsInline());
+			Test.TestEqual(FString::Printf(TEXT("%s callback allocations"), ActionName), NewAllocationsNum, 0);
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 CallIndex = 0; CallIndex < CallsNum; CallIndex++)
+			{
+				Callback(Args...);
+			}
+			NewCallTime = FPlatformTime::Seconds() - StartTime;
+		}
+
+		Test.AddInfo(FString::Printf(TEXT("%s: size %d -> %d bytes, allocations %d -> %d, call %.2f -> %.2f ns"), ActionName,
+			static_cast<int32>(sizeof(FOldStorage)), static_cast<int32>(sizeof(CallbackType)), OldAllocationsNum, NewAllocationsNum,
+			OldCallTime * 1e9 / CallsNum, NewCallTime * 1e9 / CallsNum));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFCallbackInlineStorageTest, "EnhancedCodeFlow.Callback.InlineStorage", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFCallbackInlineStorageTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFCallbackTests;
+
+	// Lambdas capture what the usual callbacks do: a weak owner and a pointer to its data.
+	TWeakObjectPtr<const UObject> WeakOwner;
+	int32 CallsCount = 0;
+	int32* CallsCountPtr = &CallsCount;
+
+	MeasureCallback<TECFCallback<void(bool), void()>, TUniqueFunction<void(bool)>>(*this, TEXT("Delay"),
+		[WeakOwner, CallsCountPtr](bool bStopped) { *CallsCountPtr += WeakOwner.IsValid() ? 2 : 1; }, false);
+
+	MeasureCallback<TECFCallback<void(float, FECFHandle), void(float)>, TUniqueFunction<void(float)>>(*this, TEXT("Ticker"),
+		[WeakOwner, CallsCountPtr](float DeltaTime) { *CallsCountPtr += WeakOwner.IsValid() ? 2 : 1; }, 0.016f);
+
+	MeasureCallback<TECFCallback<void(float, float, bool), void(float, float)>, TUniqueFunction<void(float, float, bool)>>(*this, TEXT("Timeline"),
+		[WeakOwner, CallsCountPtr](float Value, float Time, bool bStopped) { *CallsCountPtr += WeakOwner.IsValid() ? 2 : 1; }, 0.5f, 1.f, false);
+
+	MeasureCallback<TECFCallback<bool(float), bool()>, TUniqueFunction<bool(float)>>(*this, TEXT("WaitAndExecute"),
+		[WeakOwner, CallsCountPtr](float DeltaTime) { *CallsCountPtr += 1; return WeakOwner.IsValid(); }, 0.016f);
+
+	// Timeline tick functions are called every frame, so they are measured too.
+	MeasureCallback<TECFCallback<void(float, float)>, TUniqueFunction<void(float, float)>>(*this, TEXT("Timeline tick"),
+		[WeakOwner, CallsCountPtr](float Value, float Time) { *CallsCountPtr += WeakOwner.IsValid() ? 2 : 1; }, 0.5f, 1.f);
+
+	MeasureCallback<TECFCallback<void(FVector, float)>, TUniqueFunction<void(FVector, float)>>(*this, TEXT("Timeline Vector tick"),
+		[WeakOwner, CallsCountPtr](FVector Value, float Time) { *CallsCountPtr += WeakOwner.IsValid() ? 2 : 1; }, FVector::OneVector, 1.f);
+
+	MeasureCallback<TECFCallback<void(FLinearColor, float)>, TUniqueFunction<void(FLinearColor, float)>>(*this, TEXT("Timeline Linear Color tick"),
+		[WeakOwner, CallsCountPtr](FLinearColor Value, float Time) { *CallsCountPtr += WeakOwner.IsValid() ? 2 : 1; }, FLinearColor::White, 1.f);
+
+	TestEqual(TEXT("All callbacks have been called"), CallsCount, CallsNum * 14);
+
+	// Functions which don't fit are allocated and still work after being moved.
+	{
+		uint8 BigCapture[ECF_CALLBACK_INLINE_SIZE + 1] = {};
+		TECFCallback<void(bool), void()> BigCallback([BigCapture, CallsCountPtr]() { *CallsCountPtr += 1 + BigCapture[0]; });
+		TestFalse(TEXT("Big callback is allocated"), BigCallback.IsInline());
+
+		TECFCallback<void(bool), void()> MovedCallback = MoveTemp(BigCallback);
+		TestFalse(TEXT("Moved callback is unset"), BigCallback.IsSet());
+
+		CallsCount = 0;
+		MovedCallback(true);
+		TestEqual(TEXT("Big callback has been called"), CallsCount, 1);
+	}
+
+	// Unset functions leave the callback unset.
+	{
+		TECFCallback<void(bool), void()> EmptyCallback(TUniqueFunction<void()>{});
+		TestFalse(TEXT("Callback of an unset function is unset"), EmptyCallback.IsSet());
+	}
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EnhancedCodeFlow.h"
+#include "ECFSettings.h"
+#include "GameFramework/WorldSettings.h"
+#include "ECFTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFClockTests
+{
+	// Delta time exactly representable as float, so lane times can be compared exactly.
+	constexpr float DeltaTime = 0.125f;
+	constexpr float DelayTime = 1.f;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFClockPausedTimeTest, "EnhancedCodeFlow.Clock.PausedTime", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFClockPausedTimeTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFClockTests;
+
+	// Light delays keep their paused time differently, so the delay is kept as an action.
+	TGuardValue<bool> UseLightDelaysGuard(GetMutableDefault<UECFSettings>()->bUseLightDelays, false);
+	FECFTestWorld TestWorld;
+	UWorld* World = TestWorld.GetWorld();
+
+	bool bCompleted = false;
+	const FECFHandle Handle = FFlow::Delay(World, DelayTime, [&bCompleted]() { bCompleted = true; });
+	TestWorld.TickFrames(2, DeltaTime);
+
+	// The paused action is still ticked once before it becomes dormant. That frame must count as paused too.
+	FFlow::PauseAction(World, Handle);
+	TestWorld.TickFrames(4, DeltaTime);
+	FFlow::ResumeAction(World, Handle);
+
+	TestEqual(TEXT("Time of the delay doesn't include the time it has been paused"), FFlow::GetActionTime(World, Handle), 2 * DeltaTime);
+
+	TestWorld.TickFrames(FMath::FloorToInt((DelayTime - 2 * DeltaTime) / DeltaTime) - 1, DeltaTime);
+	TestFalse(TEXT("Delay is not completed before its time"), bCompleted);
+
+	TestWorld.TickFrames(3, DeltaTime);
+	TestTrue(TEXT("Delay is completed after its time"), bCompleted);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFClockTickGroupTimeDilationTest, "EnhancedCodeFlow.Clock.TickGroupTimeDilation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFClockTickGroupTimeDilationTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFClockTests;
+
+	FECFTestWorld TestWorld;
+	UWorld* World = TestWorld.GetWorld();
+	World->GetWorldSettings()->TimeDilation = 2.f;
+
+	FECFActionSettings Settings;
+	Settings.TickGroup = EECFTickGroup::PrePhysics;
+
+	TArray<float> TickDeltaTimes;
+	TArray<float> UndilatedTickDeltaTimes;
+	FFlow::AddTicker(World, [&TickDeltaTimes](float TickDeltaTime) { TickDeltaTimes.Add(TickDeltaTime); }, nullptr, Settings);
+	Settings.bIgnoreGlobalTimeDilation = true;
+	FFlow::AddTicker(World, [&UndilatedTickDeltaTimes](float TickDeltaTime) { UndilatedTickDeltaTimes.Add(TickDeltaTime); }, nullptr, Settings);
+
+	// The first frame is prepared by the tick function, which gets the delta time already dilated by the world.
+	// The time dilation must be applied to it only once.
+	TestWorld.TickWithTickGroupFirst(EECFTickGroup::PrePhysics, DeltaTime);
+	TestWorld.TickWithTickGroupFirst(EECFTickGroup::PrePhysics, DeltaTime);
+
+	if (TestEqual(TEXT("Dilated ticker has been ticked every frame"), TickDeltaTimes.Num(), 2)
+		&& TestEqual(TEXT("Undilated ticker has been ticked every frame"), UndilatedTickDeltaTimes.Num(), 2))
+	{
+		for (int32 TickIndex = 0; TickIndex < 2; TickIndex++)
+		{
+			TestEqual(TEXT("Ticker gets the delta time dilated once"), TickDeltaTimes[TickIndex], DeltaTime * 2.f);
+			TestEqual(TEXT("Ticker ignoring the time dilation gets the undilated delta time"), UndilatedTickDeltaTimes[TickIndex], DeltaTime);
+		}
+	}
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
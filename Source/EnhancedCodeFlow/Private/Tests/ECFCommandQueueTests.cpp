@@ -0,0 +1,148 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "EnhancedCodeFlow.h"
+#include "ECFTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFCommandQueueTests
+{
+	constexpr int32 ThreadsNum = 8;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	// Starts endless tickers from worker threads. Every thread keeps the handles it got in its own array.
+	TArray<FECFHandle> StartTickersFromThreads(UWorld* World, int32 TickersNum)
+	{
+		TSharedPtr<FECFCommandQueue, ESPMode::ThreadSafe> CommandQueue = FFlow::GetCommandQueue(World);
+
+		TArray<TArray<FECFHandle>> ThreadHandles;
+		ThreadHandles.SetNum(ThreadsNum);
+		ParallelFor(ThreadsNum, [World, TickersNum, &CommandQueue, &ThreadHandles](int32 ThreadIndex)
+		{
+			for (int32 TickerIndex = ThreadIndex; TickerIndex < TickersNum; TickerIndex += ThreadsNum)
+			{
+				ThreadHandles[ThreadIndex].Add(CommandQueue->StartAction([World]()
+				{
+					FFlow::AddTicker(World, [](float TickDeltaTime) {});
+				}));
+			}
+		});
+
+		TArray<FECFHandle> Handles;
+		for (const TArray<FECFHandle>& Handle : ThreadHandles)
+		{
+			Handles.Append(Handle);
+		}
+		return Handles;
+	}
+
+	int32 CountValidHandles(const TArray<FECFHandle>& Handles)
+	{
+		int32 ValidHandlesNum = 0;
+		for (const FECFHandle& Handle : Handles)
+		{
+			ValidHandlesNum += Handle.IsValid() ? 1 : 0;
+		}
+		return ValidHandlesNum;
+	}
+
+	bool AreValidHandlesUnique(const TArray<FECFHandle>& Handles)
+	{
+		TSet<uint64> RawHandles;
+		for (const FECFHandle& Handle : Handles)
+		{
+			if (Handle.IsValid())
+			{
+				bool bIsAlreadyInSet = false;
+				RawHandles.Add((static_cast<uint64>(Handle.GetGeneration()) << 32) | Handle.GetSlotIndex(), &bIsAlreadyInSet);
+				if (bIsAlreadyInSet)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFCommandQueueReservedHandlesTest, "EnhancedCodeFlow.CommandQueue.ReservedHandles", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFCommandQueueReservedHandlesTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFCommandQueueTests;
+
+	constexpr int32 MaxReservedHandles = static_cast<int32>(FECFCommandQueue::MaxReservedHandles);
+	TSharedPtr<FECFCommandQueue, ESPMode::ThreadSafe> CommandQueue;
+	{
+		FECFTestWorld TestWorld;
+		UWorld* World = TestWorld.GetWorld();
+		CommandQueue = FFlow::GetCommandQueue(World);
+
+		// More actions than reserved handles. Threads can take every reserved handle only once.
+		// Actions which haven't got handles are started anyway.
+		const int32 FirstTickersNum = MaxReservedHandles + 64;
+		const TArray<FECFHandle> FirstHandles = StartTickersFromThreads(World, FirstTickersNum);
+		TestEqual(TEXT("All reserved handles have been taken"), CountValidHandles(FirstHandles), MaxReservedHandles);
+		TestTrue(TEXT("Reserved handles are unique"), AreValidHandlesUnique(FirstHandles));
+		TestEqual(TEXT("Actions are not started before the tick"), FFlow::GetActionsCount(World), 0);
+
+		TestWorld.Tick(DeltaTime);
+		TestEqual(TEXT("All actions have been started"), FFlow::GetActionsCount(World), FirstTickersNum);
+
+		int32 RunningActionsNum = 0;
+		for (const FECFHandle& Handle : FirstHandles)
+		{
+			RunningActionsNum += (Handle.IsValid() && FFlow::IsActionRunning(World, Handle)) ? 1 : 0;
+		}
+		TestEqual(TEXT("Actions got their reserved handles"), RunningActionsNum, MaxReservedHandles);
+
+		// The tick refills the ring, so it wraps around and gives handles different than the ones in use.
+		TArray<FECFHandle> AllHandles = FirstHandles;
+		AllHandles.Append(StartTickersFromThreads(World, MaxReservedHandles));
+		TestEqual(TEXT("Reserved handles have been refilled"), CountValidHandles(AllHandles), MaxReservedHandles * 2);
+		TestTrue(TEXT("Refilled handles are not the ones in use"), AreValidHandlesUnique(AllHandles));
+		TestWorld.Tick(DeltaTime);
+		TestEqual(TEXT("Actions with refilled handles have been started"), FFlow::GetActionsCount(World), FirstTickersNum + MaxReservedHandles);
+		FFlow::StopAllActions(World);
+		TestWorld.Tick(DeltaTime);
+
+		// Commands are executed in the order they have been submitted, so a reserved handle can be controlled
+		// before its action is started.
+		const FECFHandle ControlledHandle = CommandQueue->StartAction([World]()
+		{
+			FFlow::AddTicker(World, [](float TickDeltaTime) {});
+		});
+		CommandQueue->PauseAction(ControlledHandle);
+		TestWorld.Tick(DeltaTime);
+
+		bool bIsPaused = false;
+		TestTrue(TEXT("Action controlled before being started is running"), FFlow::IsActionPaused(World, ControlledHandle, bIsPaused));
+		TestTrue(TEXT("Action paused before being started is paused"), bIsPaused);
+
+		CommandQueue->ResumeAction(ControlledHandle);
+		CommandQueue->StopAction(ControlledHandle);
+		TestWorld.Tick(DeltaTime);
+		TestFalse(TEXT("Action stopped by the command is not running"), FFlow::IsActionRunning(World, ControlledHandle));
+
+		// Reserved handles of functions that start no actions are released.
+		const FECFHandle UnusedHandle = CommandQueue->StartAction([]() {});
+		TestTrue(TEXT("Function starting no action gets a reserved handle"), UnusedHandle.IsValid());
+		TestWorld.Tick(DeltaTime);
+		TestFalse(TEXT("Unused reserved handle doesn't point to an action"), FFlow::IsActionRunning(World, UnusedHandle));
+	}
+
+	// The queue can outlive its subsystem, but it doesn't accept commands anymore.
+	const FECFHandle ClosedQueueHandle = CommandQueue->StartAction([]() {});
+	TestFalse(TEXT("Queue of the destroyed subsystem gives no handles"), ClosedQueueHandle.IsValid());
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
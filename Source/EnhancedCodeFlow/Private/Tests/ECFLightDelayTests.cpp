@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EnhancedCodeFlow.h"
+#include "ECFSettings.h"
+#include "CodeFlowActions/ECFDelay.h"
+#include "ECFTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFLightDelayTests
+{
+	constexpr int32 DelaysNum = 1000;
+	constexpr float DelayTime = 0.5f;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	struct FDelaysResult
+	{
+		FECFTestMeasurement Start;
+		int32 ActionObjectsNum = 0;
+		int32 CompletedNum = 0;
+		double GCTime = 0.0;
+	};
+
+	// Starts delays with the given settings, collects garbage while they are running and ticks them until they end.
+	FDelaysResult RunDelays(const FECFActionSettings& Settings)
+	{
+		FDelaysResult Result;
+		FECFTestWorld TestWorld;
+		UWorld* World = TestWorld.GetWorld();
+
+		TArray<FECFHandle> Handles;
+		Handles.Reserve(DelaysNum);
+		Result.Start = ECFTests::Measure([World, &Settings, &Handles, &Result]()
+		{
+			for (int32 DelayIndex = 0; DelayIndex < DelaysNum; DelayIndex++)
+			{
+				Handles.Add(FFlow::Delay(World, DelayTime, [&Result]() { Result.CompletedNum++; }, Settings));
+			}
+		});
+
+		for (const FECFHandle& Handle : Handles)
+		{
+			if (FFlow::GetActionFromHandle(World, Handle))
+			{
+				Result.ActionObjectsNum++;
+			}
+		}
+
+		const double GCStartTime = FPlatformTime::Seconds();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		Result.GCTime = FPlatformTime::Seconds() - GCStartTime;
+
+		TestWorld.TickFrames(FMath::CeilToInt(DelayTime / DeltaTime) + 2, DeltaTime);
+
+		return Result;
+	}
+
+	FString DescribeDelays(const TCHAR* DelaysName, const FDelaysResult& Result)
+	{
+		return FString::Printf(TEXT("%s: %d action objects, %lld bytes per delay, garbage collection %.2f ms, start: %s"),
+			DelaysName, Result.ActionObjectsNum, Result.Start.AllocatedBytes / DelaysNum, Result.GCTime * 1000.0, *Result.Start.ToString());
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFLightDelayFootprintTest, "EnhancedCodeFlow.LightDelay.Footprint", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFLightDelayFootprintTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFLightDelayTests;
+
+	// The subsystem reads the settings when it is initialized, so they are changed before the worlds are created
+	// and restored when the test ends. Pooling is disabled, so every action delay creates its object.
+	UECFSettings* ECFSettings = GetMutableDefault<UECFSettings>();
+	TGuardValue<bool> UseLightDelaysGuard(ECFSettings->bUseLightDelays, true);
+	TGuardValue<bool> UseActionsPoolGuard(ECFSettings->bUseActionsPool, false);
+
+	// Delays with tick intervals can't be light, so they use action objects.
+	const FDelaysResult LightResult = RunDelays(FECFActionSettings());
+	const FDelaysResult ActionResult = RunDelays(FECFActionSettings(DelayTime));
+
+	TestEqual(TEXT("All light delays have been completed"), LightResult.CompletedNum, DelaysNum);
+	TestEqual(TEXT("All action delays have been completed"), ActionResult.CompletedNum, DelaysNum);
+	TestEqual(TEXT("Light delays have no action objects"), LightResult.ActionObjectsNum, 0);
+	TestEqual(TEXT("Light delays create no UObjects"), LightResult.Start.CreatedObjectsNum, 0);
+	TestEqual(TEXT("Action delays have action objects"), ActionResult.ActionObjectsNum, DelaysNum);
+	TestTrue(TEXT("Light delays allocate less than action delays"), LightResult.Start.AllocatedBytes < ActionResult.Start.AllocatedBytes);
+
+	// Light delays are kept in chunks of the arena, so a delay takes only its struct there.
+	AddInfo(FString::Printf(TEXT("Light delay: %d bytes in the arena, action delay: %d bytes of the object"),
+		static_cast<int32>(sizeof(FECFLightDelay)), UECFDelay::StaticClass()->GetStructureSize()));
+	AddInfo(DescribeDelays(TEXT("Light delays"), LightResult));
+	AddInfo(DescribeDelays(TEXT("Action delays"), ActionResult));
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
@@ -0,0 +1,90 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EnhancedCodeFlow.h"
+#include "ECFSettings.h"
+#include "ECFTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFLookupTests
+{
+	constexpr int32 LookupsNum = 100000;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	struct FLookupResult
+	{
+		int32 ActionsNum = 0;
+		int32 RunningNum = 0;
+		double LookupTime = 0.0;
+	};
+
+	// Starts the given number of long delays, which sleep and are not ticked, and measures looking them up by their handles.
+	FLookupResult MeasureLookups(int32 ActionsNum)
+	{
+		FLookupResult Result;
+		Result.ActionsNum = ActionsNum;
+
+		FECFTestWorld TestWorld;
+		UWorld* World = TestWorld.GetWorld();
+
+		TArray<FECFHandle> Handles;
+		Handles.Reserve(ActionsNum);
+		for (int32 ActionIndex = 0; ActionIndex < ActionsNum; ActionIndex++)
+		{
+			Handles.Add(FFlow::Delay(World, 600.f, []() {}));
+		}
+
+		// Let the delays leave the pending list and fall asleep.
+		TestWorld.TickFrames(2, DeltaTime);
+
+		// Visit handles with a prime stride, so lookups don't follow the order in which actions were started.
+		Result.LookupTime = ECFTests::Measure([&Handles, &Result, World, ActionsNum]()
+		{
+			for (int32 LookupIndex = 0; LookupIndex < LookupsNum; LookupIndex++)
+			{
+				const FECFHandle& Handle = Handles[static_cast<int32>((static_cast<int64>(LookupIndex) * 7919) % ActionsNum)];
+				Result.RunningNum += FFlow::IsActionRunning(World, Handle) ? 1 : 0;
+			}
+		}).Time;
+
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFLookupFlatCostTest, "EnhancedCodeFlow.Lookup.FlatCost", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFLookupFlatCostTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFLookupTests;
+
+	// Light delays are looked up differently, so the delays are kept as actions.
+	TGuardValue<bool> UseLightDelaysGuard(GetMutableDefault<UECFSettings>()->bUseLightDelays, false);
+
+	TArray<FLookupResult> Results;
+	for (const int32 ActionsNum : { 100, 1000, 10000, 100000 })
+	{
+		Results.Add(MeasureLookups(ActionsNum));
+	}
+
+	for (const FLookupResult& Result : Results)
+	{
+		TestEqual(FString::Printf(TEXT("All lookups among %d actions have found running actions"), Result.ActionsNum), Result.RunningNum, LookupsNum);
+		AddInfo(FString::Printf(TEXT("%d actions: %.1f ns per lookup"), Result.ActionsNum, Result.LookupTime * 1e9 / LookupsNum));
+	}
+
+	// Lookups among more actions miss the caches more often, but a search through the actions would get
+	// a thousand times slower between the smallest and the biggest set.
+	const FLookupResult& SmallestResult = Results[0];
+	const FLookupResult& BiggestResult = Results.Last();
+	TestTrue(TEXT("Lookup cost doesn't grow with the number of actions"), BiggestResult.LookupTime < SmallestResult.LookupTime * 20.0);
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
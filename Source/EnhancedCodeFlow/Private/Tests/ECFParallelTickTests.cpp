@@ -0,0 +1,216 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/App.h"
+#include "EnhancedCodeFlow.h"
+#include "ECFSettings.h"
+#include "ECFTestHelpers.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFParallelTickTests
+{
+	// More than UECFSubsystem::MinParallelTickActionsNum, so the thread safe bucket is ticked in parallel.
+	constexpr int32 TickersNum = 256;
+	constexpr float DeltaTime = 0.05f;
+	constexpr int32 FramesNum = 30;
+
+	// Time of work done by every tick, so worker threads have enough work to join the parallel tick.
+	constexpr double TickWorkTime = 0.00002;
+
+	void DoTickWork()
+	{
+		const double WorkEndTime = FPlatformTime::Seconds() + TickWorkTime;
+		while (FPlatformTime::Seconds() < WorkEndTime)
+		{
+		}
+	}
+
+	// Checks if ParallelFor can use worker threads.
+	bool HasWorkerThreads()
+	{
+		return FApp::ShouldUseThreading() && (FTaskGraphInterface::Get().GetNumWorkerThreads() > 0);
+	}
+
+	struct FTickResult
+	{
+		TArray<int32> CompletionOrder;
+		bool bCompletedOffGameThread = false;
+		bool bTickedOffGameThread = false;
+	};
+
+	// Starts tickers of a few lengths, so many of them finish in the same frames, and ticks them until all end.
+	FTickResult TickTickers(bool bThreadSafeTick)
+	{
+		FTickResult Result;
+		std::atomic<bool> bTickedOffGameThread { false };
+		FECFTestWorld TestWorld;
+
+		FECFActionSettings Settings;
+		Settings.bThreadSafeTick = bThreadSafeTick;
+
+		for (int32 TickerIndex = 0; TickerIndex < TickersNum; TickerIndex++)
+		{
+			const float TickingTime = DeltaTime * (1 + (TickerIndex * 7) % 10);
+			FFlow::AddTicker(TestWorld.GetWorld(), TickingTime,
+				[&bTickedOffGameThread](float TickDeltaTime)
+				{
+					DoTickWork();
+					if (IsInGameThread() == false)
+					{
+						bTickedOffGameThread = true;
+					}
+				},
+				[&Result, TickerIndex]()
+				{
+					Result.CompletionOrder.Add(TickerIndex);
+					if (IsInGameThread() == false)
+					{
+						Result.bCompletedOffGameThread = true;
+					}
+				},
+				Settings);
+		}
+
+		TestWorld.TickFrames(FramesNum, DeltaTime);
+
+		Result.bTickedOffGameThread = bTickedOffGameThread;
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFParallelTickOrderTest, "EnhancedCodeFlow.ParallelTick.CompletionOrder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFParallelTickOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFParallelTickTests;
+
+	const FTickResult SerialResult = TickTickers(false);
+	const FTickResult ParallelResult = TickTickers(true);
+
+	TestEqual(TEXT("All serial tickers have been completed"), SerialResult.CompletionOrder.Num(), TickersNum);
+	TestEqual(TEXT("All parallel tickers have been completed"), ParallelResult.CompletionOrder.Num(), TickersNum);
+	TestTrue(TEXT("Parallel tickers are completed in the serial order"), ParallelResult.CompletionOrder == SerialResult.CompletionOrder);
+
+	TestFalse(TEXT("Serial tickers are completed on the Game Thread"), SerialResult.bCompletedOffGameThread);
+	TestFalse(TEXT("Parallel tickers are completed on the Game Thread"), ParallelResult.bCompletedOffGameThread);
+	TestFalse(TEXT("Serial tickers are ticked on the Game Thread"), SerialResult.bTickedOffGameThread);
+
+	// ParallelFor runs on the Game Thread only when there are no workers.
+	if (HasWorkerThreads())
+	{
+		TestTrue(TEXT("Parallel tickers are ticked on worker threads"), ParallelResult.bTickedOffGameThread);
+	}
+	else
+	{
+		AddInfo(TEXT("There are no worker threads, so parallel tickers have been ticked on the Game Thread."));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFParallelTickBudgetTest, "EnhancedCodeFlow.ParallelTick.BudgetPerChunk", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFParallelTickBudgetTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFParallelTickTests;
+
+	// Ticking all tickers takes many times longer than the budget, even on many threads.
+	constexpr int32 BudgetedTickersNum = 4096;
+	constexpr int32 BudgetedFramesNum = 200;
+	TGuardValue<float> TickBudgetGuard(GetMutableDefault<UECFSettings>()->TickBudgetMs, 0.5f);
+	FECFTestWorld TestWorld;
+
+	TArray<int32> TicksNums;
+	TicksNums.SetNumZeroed(BudgetedTickersNum);
+	std::atomic<int32> FrameTicksNum { 0 };
+	for (int32 TickerIndex = 0; TickerIndex < BudgetedTickersNum; TickerIndex++)
+	{
+		// Every ticker changes only its own counter, so they don't race.
+		FFlow::AddTicker(TestWorld.GetWorld(), [&TicksNums, &FrameTicksNum, TickerIndex](float TickDeltaTime)
+		{
+			DoTickWork();
+			TicksNums[TickerIndex]++;
+			FrameTicksNum++;
+		}, nullptr, ECF_THREADSAFETICK);
+	}
+
+	// Adding the tickers to their bucket takes a part of the budget of the first frame, so check the next one.
+	TestWorld.Tick(DeltaTime);
+	FrameTicksNum = 0;
+	TestWorld.Tick(DeltaTime);
+	const int32 CheckedFrameTicksNum = FrameTicksNum;
+	TestTrue(TEXT("Some tickers have been ticked within the budget"), CheckedFrameTicksNum > 0);
+	TestTrue(TEXT("Tickers above the budget have been deferred"), CheckedFrameTicksNum < BudgetedTickersNum);
+
+	TestWorld.Tick(DeltaTime);
+	TestEqual(TEXT("Deferred tickers have been counted"), FFlow::GetDeferredActionsCount(TestWorld.GetWorld()), BudgetedTickersNum - CheckedFrameTicksNum);
+
+	// Deferred tickers are ticked first in the next frames, so all of them get their turns.
+	TestWorld.TickFrames(BudgetedFramesNum, DeltaTime);
+	int32 NotTickedTickersNum = 0;
+	for (int32 TicksNum : TicksNums)
+	{
+		NotTickedTickersNum += (TicksNum == 0) ? 1 : 0;
+	}
+	TestEqual(TEXT("All tickers have been ticked in turns"), NotTickedTickersNum, 0);
+	AddInfo(FString::Printf(TEXT("%d of %d tickers ticked in one frame within the budget of 0.5 ms"), CheckedFrameTicksNum, BudgetedTickersNum));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFParallelTickScalingTest, "EnhancedCodeFlow.ParallelTick.Scaling", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFParallelTickScalingTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFParallelTickTests;
+
+	constexpr int32 ScaledTickersNum = 4096;
+	constexpr int32 MeasuredFramesNum = 10;
+	const int32 AvailableThreadsNum = HasWorkerThreads() ? FTaskGraphInterface::Get().GetNumWorkerThreads() + 1 : 1;
+
+	double SingleThreadFrameTime = 0.0;
+	for (const int32 ThreadsNum : { 1, 4, 8, 16 })
+	{
+		// The subsystem reads the settings when it is initialized, so they are changed before the world is created.
+		TGuardValue<int32> ThreadsGuard(GetMutableDefault<UECFSettings>()->MaxParallelTickThreads, ThreadsNum);
+		FECFTestWorld TestWorld;
+
+		std::atomic<int32> TicksNum { 0 };
+		for (int32 TickerIndex = 0; TickerIndex < ScaledTickersNum; TickerIndex++)
+		{
+			FFlow::AddTicker(TestWorld.GetWorld(), [&TicksNum](float TickDeltaTime)
+			{
+				DoTickWork();
+				TicksNum++;
+			}, nullptr, ECF_THREADSAFETICK);
+		}
+
+		// The first frame adds the tickers to their bucket.
+		TestWorld.Tick(DeltaTime);
+		TicksNum = 0;
+
+		const FECFTestMeasurement Measurement = ECFTests::Measure([&TestWorld]() { TestWorld.TickFrames(MeasuredFramesNum, DeltaTime); });
+		const double FrameTime = Measurement.Time / MeasuredFramesNum;
+		if (ThreadsNum == 1)
+		{
+			SingleThreadFrameTime = FrameTime;
+		}
+
+		TestEqual(FString::Printf(TEXT("All tickers have been ticked on %d threads"), ThreadsNum), TicksNum.load(), ScaledTickersNum * MeasuredFramesNum);
+		AddInfo(FString::Printf(TEXT("%d threads%s: %.2f ms per frame, %.2fx speed of 1 thread"), ThreadsNum,
+			(ThreadsNum > AvailableThreadsNum) ? *FString::Printf(TEXT(" (only %d available)"), AvailableThreadsNum) : TEXT(""),
+			FrameTime * 1000.0, SingleThreadFrameTime / FrameTime));
+	}
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EnhancedCodeFlow.h"
+#include "ECFSettings.h"
+#include "ECFTestHelpers.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFSteadyFrameTests
+{
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	// Buffers are checked for shrinking every 600 frames, so both phases go through a few checks.
+	constexpr int32 WarmUpFramesNum = 1800;
+	constexpr int32 MeasuredFramesNum = 1800;
+
+	// Delay which starts itself again when it ends, so light delays are constantly finished and started.
+	struct FDelayLoop
+	{
+		void Start()
+		{
+			FFlow::Delay(World, DelayTime, [this]()
+			{
+				FinishesNum++;
+				Start();
+			});
+		}
+
+		UWorld* World = nullptr;
+		float DelayTime = 0.f;
+		int32 FinishesNum = 0;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFSteadyFrameAllocationsTest, "EnhancedCodeFlow.SteadyFrame.NoAllocations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFSteadyFrameAllocationsTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFSteadyFrameTests;
+
+	// Restarted delays are measured as light delays, which are enabled before the subsystem reads the settings.
+	TGuardValue<bool> UseLightDelaysGuard(GetMutableDefault<UECFSettings>()->bUseLightDelays, true);
+	FECFTestWorld TestWorld;
+	UWorld* World = TestWorld.GetWorld();
+	int32 TicksNum = 0;
+
+	// Tickers ticked every frame, which are compacted in their bucket.
+	for (int32 TickerIndex = 0; TickerIndex < 200; TickerIndex++)
+	{
+		FFlow::AddTicker(World, [&TicksNum](float TickDeltaTime) { TicksNum++; });
+	}
+
+	// Tickers with intervals, which go to sleep in the timer wheel and are woken up every few frames.
+	// The longest intervals don't fit the first level of the wheel, so they are cascaded.
+	for (int32 TickerIndex = 0; TickerIndex < 200; TickerIndex++)
+	{
+		const float TickInterval = (TickerIndex < 150) ? 0.1f * (1 + TickerIndex % 10) : 5.f + (TickerIndex % 5);
+		FFlow::AddTicker(World, [&TicksNum](float TickDeltaTime) { TicksNum++; }, nullptr, ECF_TICKINTERVAL(TickInterval));
+	}
+
+	// Delays finished and started again, which go through the pending, due and firing buffers.
+	TArray<FDelayLoop> DelayLoops;
+	DelayLoops.SetNum(100);
+	for (int32 LoopIndex = 0; LoopIndex < DelayLoops.Num(); LoopIndex++)
+	{
+		DelayLoops[LoopIndex].World = World;
+		DelayLoops[LoopIndex].DelayTime = 0.25f * (1 + LoopIndex % 10);
+		DelayLoops[LoopIndex].Start();
+	}
+
+	// Let the buffers, the timer wheel slots and the pools reach the sizes they need.
+	TestWorld.TickFrames(WarmUpFramesNum, DeltaTime);
+
+	const int32 WarmUpTicksNum = TicksNum;
+	int32 WarmUpFinishesNum = 0;
+	for (const FDelayLoop& DelayLoop : DelayLoops)
+	{
+		WarmUpFinishesNum += DelayLoop.FinishesNum;
+	}
+
+	const FECFTestMeasurement Measurement = ECFTests::Measure([&TestWorld]() { TestWorld.TickFrames(MeasuredFramesNum, DeltaTime); });
+
+	int32 FinishesNum = 0;
+	for (const FDelayLoop& DelayLoop : DelayLoops)
+	{
+		FinishesNum += DelayLoop.FinishesNum;
+	}
+
+	TestTrue(TEXT("Tickers have been ticked while measured"), TicksNum > WarmUpTicksNum);
+	TestTrue(TEXT("Delays have been finished while measured"), FinishesNum > WarmUpFinishesNum);
+	TestEqual(TEXT("Allocations in steady frames"), Measurement.AllocationsNum, 0);
+	AddInfo(FString::Printf(TEXT("%d frames: %s"), MeasuredFramesNum, *Measurement.ToString()));
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
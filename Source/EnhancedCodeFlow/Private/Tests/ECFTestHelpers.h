@@ -0,0 +1,241 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTLS.h"
+#include "UObject/UObjectArray.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/App.h"
+#include "Tickable.h"
+#include "ECFSubsystem.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Helpers shared by ECF automation tests: a world with the ECF subsystem ticked by hand, and measuring
+ * heap allocations, created UObjects and time of the given code.
+ */
+
+// Result of measuring the code run on the Game Thread.
+struct FECFTestMeasurement
+{
+	// Number of heap allocations and reallocations made by the measuring thread.
+	int32 AllocationsNum = 0;
+
+	// Number of bytes requested by these allocations.
+	int64 AllocatedBytes = 0;
+
+	// Number of UObjects created, minus the ones destroyed.
+	int32 CreatedObjectsNum = 0;
+
+	// Time of the code in seconds.
+	double Time = 0.0;
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("%d allocations (%lld bytes), %d new UObjects, %.3f ms"), AllocationsNum, AllocatedBytes, CreatedObjectsNum, Time * 1000.0);
+	}
+};
+
+namespace ECFTests
+{
+	/**
+	 * Proxy of GMalloc counting allocations of the measuring thread.
+	 * The engine doesn't count allocations (LLM only tracks the current amount of memory per tag and is disabled by default),
+	 * so the proxy is put in front of GMalloc the first time it is needed and stays there, so it is never swapped
+	 * while other threads use it. It only passes calls when nothing is measured.
+	 */
+	class FCountingMalloc : public FMalloc
+	{
+
+	public:
+
+		static FCountingMalloc& Get()
+		{
+			check(IsInGameThread());
+			static FCountingMalloc* CountingMalloc = []()
+			{
+				FCountingMalloc* NewCountingMalloc = new FCountingMalloc(GMalloc);
+				GMalloc = NewCountingMalloc;
+				return NewCountingMalloc;
+			}();
+			return *CountingMalloc;
+		}
+
+		// Starts counting allocations of the calling thread. Measurements can't be nested.
+		void Start()
+		{
+			check(MeasuringThreadId.load() == 0);
+			AllocationsNum = 0;
+			AllocatedBytes = 0;
+			MeasuringThreadId.store(FPlatformTLS::GetCurrentThreadId());
+		}
+
+		void Stop()
+		{
+			MeasuringThreadId.store(0);
+		}
+
+		int32 GetAllocationsNum() const { return AllocationsNum; }
+		int64 GetAllocatedBytes() const { return AllocatedBytes; }
+
+		void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			// Reallocation to zero bytes only frees the memory.
+			if (Count > 0)
+			{
+				CountAllocation(Count);
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		void Free(void* Original) override { Inner->Free(Original); }
+		bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+
+		explicit FCountingMalloc(FMalloc* InInner) :
+			Inner(InInner)
+		{
+		}
+
+		void CountAllocation(SIZE_T Size)
+		{
+			const uint32 ThreadId = MeasuringThreadId.load(std::memory_order_relaxed);
+			if ((ThreadId != 0) && (ThreadId == FPlatformTLS::GetCurrentThreadId()))
+			{
+				AllocationsNum++;
+				AllocatedBytes += Size;
+			}
+		}
+
+		FMalloc* Inner = nullptr;
+		std::atomic<uint32> MeasuringThreadId { 0 };
+
+		// Changed only by the measuring thread.
+		int32 AllocationsNum = 0;
+		int64 AllocatedBytes = 0;
+	};
+
+	// Runs the given function on the Game Thread and measures it.
+	inline FECFTestMeasurement Measure(TFunctionRef<void()> Func)
+	{
+		FCountingMalloc& CountingMalloc = FCountingMalloc::Get();
+		FECFTestMeasurement Result;
+		const int32 ObjectsNumBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		const double StartTime = FPlatformTime::Seconds();
+
+		CountingMalloc.Start();
+		Func();
+		CountingMalloc.Stop();
+
+		Result.Time = FPlatformTime::Seconds() - StartTime;
+		Result.AllocationsNum = CountingMalloc.GetAllocationsNum();
+		Result.AllocatedBytes = CountingMalloc.GetAllocatedBytes();
+		Result.CreatedObjectsNum = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsNumBefore;
+		return Result;
+	}
+}
+
+/**
+ * Standalone Game World with its own ECF subsystem, which tests tick by hand.
+ * The world is destroyed when it goes out of scope.
+ */
+class FECFTestWorld
+{
+
+public:
+
+	FECFTestWorld()
+	{
+		GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone();
+		World = GameInstance->GetWorld();
+		ECF = GameInstance->GetSubsystem<UECFSubsystem>();
+	}
+
+	~FECFTestWorld()
+	{
+		GameInstance->Shutdown();
+		World->DestroyWorld(false);
+		GEngine->DestroyWorldContext(World);
+		GameInstance->RemoveFromRoot();
+	}
+
+	// Ticks the subsystem as one frame of the game.
+	void Tick(float DeltaTime)
+	{
+		// The subsystem prepares every frame once, recognizing it by the frame counter.
+		GFrameCounter++;
+		FApp::SetDeltaTime(DeltaTime);
+		static_cast<FTickableGameObject*>(ECF)->Tick(DeltaTime);
+	}
+
+	// Ticks one frame in which the given tick group is ticked by its tick function before the subsystem ticks.
+	void TickWithTickGroupFirst(EECFTickGroup TickGroup, float DeltaTime)
+	{
+		GFrameCounter++;
+		FApp::SetDeltaTime(DeltaTime);
+
+		// The engine gives tick functions the delta time dilated by the world.
+		FECFTickFunction TickFunction;
+		TickFunction.Subsystem = ECF;
+		TickFunction.ActionsTickGroup = TickGroup;
+		TickFunction.ExecuteTick(DeltaTime * World->GetWorldSettings()->TimeDilation, LEVELTICK_All, ENamedThreads::GameThread, FGraphEventRef());
+
+		static_cast<FTickableGameObject*>(ECF)->Tick(DeltaTime);
+	}
+
+	// Ticks the given number of frames.
+	void TickFrames(int32 FramesNum, float DeltaTime)
+	{
+		for (int32 FrameIndex = 0; FrameIndex < FramesNum; FrameIndex++)
+		{
+			Tick(DeltaTime);
+		}
+	}
+
+	UWorld* GetWorld() const
+	{
+		return World;
+	}
+
+	UECFSubsystem* GetSubsystem() const
+	{
+		return ECF;
+	}
+
+private:
+
+	UGameInstance* GameInstance = nullptr;
+	UWorld* World = nullptr;
+	UECFSubsystem* ECF = nullptr;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
@@ -0,0 +1,185 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "ECFTimerWheel.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFTimerWheelTests
+{
+	// Entry scheduled when the wheel reaches the given tick. Delays are given in ticks of a wheel with 1 second resolution.
+	struct FScheduledEntry
+	{
+		uint64 ScheduleTick = 0;
+		uint64 DelayTicks = 0;
+	};
+
+	// Delays in every level of the wheel and on the borders between them, scheduled from the start and later,
+	// so they are cascaded from slots that are not aligned with the start of the wheel.
+	const TArray<FScheduledEntry>& GetScheduledEntries()
+	{
+		static const TArray<FScheduledEntry> ScheduledEntries = []()
+		{
+			const uint64 Delays[] = { 1, 2, 100, 255, 256, 257, 300, 511, 512, 1000, 4096, 65535, 65536, 65537, 70000 };
+			const uint64 ScheduleTicks[] = { 0, 1, 200, 255, 256, 1000 };
+
+			TArray<FScheduledEntry> Entries;
+			for (uint64 ScheduleTick : ScheduleTicks)
+			{
+				for (uint64 Delay : Delays)
+				{
+					Entries.Add({ ScheduleTick, Delay });
+				}
+			}
+			return Entries;
+		}();
+		return ScheduledEntries;
+	}
+
+	uint64 GetLastDueTick()
+	{
+		uint64 LastDueTick = 0;
+		for (const FScheduledEntry& Entry : GetScheduledEntries())
+		{
+			LastDueTick = FMath::Max(LastDueTick, Entry.ScheduleTick + Entry.DelayTicks);
+		}
+		return LastDueTick;
+	}
+
+	// Schedules entries which should be scheduled at the given tick. Sleep ids are indices of entries.
+	void ScheduleEntries(FECFTimerWheel& Wheel, uint64 Tick)
+	{
+		const TArray<FScheduledEntry>& Entries = GetScheduledEntries();
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+		{
+			if (Entries[EntryIndex].ScheduleTick == Tick)
+			{
+				Wheel.Schedule(FECFHandle(EntryIndex + 1, 1), EntryIndex, static_cast<double>(Tick + Entries[EntryIndex].DelayTicks));
+			}
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFTimerWheelDueTimesTest, "EnhancedCodeFlow.TimerWheel.DueTimes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFTimerWheelDueTimesTest::RunTest(const FString& Parameters)
+{
+	// Resolution which is exact in binary, so ticks of the given times are known.
+	FECFTimerWheel Wheel(0.25);
+	TArray<FECFTimerWheel::FEntry> DueEntries;
+
+	// Entries are released at the beginning of the tick they are due in, so up to one resolution earlier.
+	Wheel.Schedule(FECFHandle(1, 1), 1, 1.3);
+	TestEqual(TEXT("Scheduled entries are counted"), Wheel.Num(), 1);
+
+	Wheel.Advance(1.2, DueEntries);
+	TestEqual(TEXT("Entry is not released before its tick"), DueEntries.Num(), 0);
+
+	Wheel.Advance(1.25, DueEntries);
+	TestEqual(TEXT("Entry is released at the beginning of its tick"), DueEntries.Num(), 1);
+	if (DueEntries.Num() == 1)
+	{
+		TestTrue(TEXT("Released entry keeps its handle"), DueEntries[0].Handle == FECFHandle(1, 1));
+		TestTrue(TEXT("Released entry keeps its sleep id"), DueEntries[0].SleepId == 1);
+		TestTrue(TEXT("Released entry has its due tick"), DueEntries[0].DueTick == 5);
+	}
+	TestEqual(TEXT("Released entries are not counted"), Wheel.Num(), 0);
+
+	// The current tick has been already released, so entries due in the past are released in the next one.
+	DueEntries.Reset();
+	Wheel.Schedule(FECFHandle(2, 1), 2, 0.5);
+	Wheel.Schedule(FECFHandle(3, 1), 3, 1.25);
+	Wheel.Advance(1.25, DueEntries);
+	TestEqual(TEXT("Entries due in the past are not released in the current tick"), DueEntries.Num(), 0);
+	Wheel.Advance(1.5, DueEntries);
+	TestEqual(TEXT("Entries due in the past are released in the next tick"), DueEntries.Num(), 2);
+
+	// Reset removes entries and moves the wheel back to the start.
+	DueEntries.Reset();
+	Wheel.Schedule(FECFHandle(4, 1), 4, 100.0);
+	Wheel.Reset();
+	TestEqual(TEXT("Reset removes entries"), Wheel.Num(), 0);
+	Wheel.Schedule(FECFHandle(5, 1), 5, 0.25);
+	Wheel.Advance(0.25, DueEntries);
+	TestEqual(TEXT("Reset moves the wheel back to the start"), DueEntries.Num(), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFTimerWheelCascadeTest, "EnhancedCodeFlow.TimerWheel.Cascade", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FECFTimerWheelCascadeTest::RunTest(const FString& Parameters)
+{
+	using namespace ECFTimerWheelTests;
+
+	const TArray<FScheduledEntry>& Entries = GetScheduledEntries();
+	const uint64 LastDueTick = GetLastDueTick();
+
+	// Advance tick by tick, so every entry must be released exactly in its tick, after being cascaded through the levels.
+	{
+		FECFTimerWheel Wheel(1.0);
+		TArray<uint64> ReleaseTicks;
+		ReleaseTicks.Init(0, Entries.Num());
+		TArray<FECFTimerWheel::FEntry> DueEntries;
+
+		ScheduleEntries(Wheel, 0);
+		for (uint64 Tick = 1; Tick <= LastDueTick; Tick++)
+		{
+			DueEntries.Reset();
+			Wheel.Advance(static_cast<double>(Tick), DueEntries);
+			for (const FECFTimerWheel::FEntry& DueEntry : DueEntries)
+			{
+				ReleaseTicks[DueEntry.SleepId] = Tick;
+			}
+			ScheduleEntries(Wheel, Tick);
+		}
+
+		int32 LateOrEarlyEntriesNum = 0;
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+		{
+			const uint64 DueTick = Entries[EntryIndex].ScheduleTick + Entries[EntryIndex].DelayTicks;
+			if (ReleaseTicks[EntryIndex] != DueTick)
+			{
+				LateOrEarlyEntriesNum++;
+				AddError(FString::Printf(TEXT("Entry scheduled at %llu for %llu ticks released at %llu"), Entries[EntryIndex].ScheduleTick, Entries[EntryIndex].DelayTicks, ReleaseTicks[EntryIndex]));
+			}
+		}
+		TestEqual(TEXT("Entries released in other ticks than their due ones"), LateOrEarlyEntriesNum, 0);
+		TestEqual(TEXT("All entries have been released"), Wheel.Num(), 0);
+	}
+
+	// Advance over all due ticks at once, so entries are cascaded and released in the same call, in the order of their ticks.
+	{
+		FECFTimerWheel Wheel(1.0);
+		TArray<FECFTimerWheel::FEntry> DueEntries;
+		int32 ScheduledNum = 0;
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+		{
+			if (Entries[EntryIndex].ScheduleTick == 0)
+			{
+				Wheel.Schedule(FECFHandle(EntryIndex + 1, 1), EntryIndex, static_cast<double>(Entries[EntryIndex].DelayTicks));
+				ScheduledNum++;
+			}
+		}
+
+		Wheel.Advance(static_cast<double>(LastDueTick), DueEntries);
+		TestEqual(TEXT("All entries have been released at once"), DueEntries.Num(), ScheduledNum);
+		TestEqual(TEXT("No entries are left after releasing all at once"), Wheel.Num(), 0);
+
+		bool bIsSorted = true;
+		for (int32 DueIndex = 1; DueIndex < DueEntries.Num(); DueIndex++)
+		{
+			bIsSorted &= DueEntries[DueIndex - 1].DueTick <= DueEntries[DueIndex].DueTick;
+		}
+		TestTrue(TEXT("Entries released at once are in the order of their ticks"), bIsSorted);
+	}
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
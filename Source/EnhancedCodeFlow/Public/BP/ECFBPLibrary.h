@@ -41,6 +41,30 @@ public:
 	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "ECF - Set Pause Subsystem"), Category = "ECF")
 	static void ECFGetPause(const UObject* WorldContextObject, UPARAM(DisplayName = "IsPaused") bool& bIsPaused);
 
+	/**
+	 * Sets if the given clock is paused or not. None means the Gameplay clock.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", DisplayName = "ECF - Set Clock Paused"), Category = "ECF")
+	static void ECFSetClockPaused(const UObject* WorldContextObject, FName Clock, bool bPaused);
+
+	/**
+	 * Checks if the given clock is paused or not.
+	 */
+	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "ECF - Is Clock Paused"), Category = "ECF")
+	static void ECFIsClockPaused(const UObject* WorldContextObject, FName Clock, UPARAM(DisplayName = "IsPaused") bool& bIsPaused);
+
+	/**
+	 * Sets the time scale of the given clock. None means the Gameplay clock.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject", DisplayName = "ECF - Set Clock Time Scale"), Category = "ECF")
+	static void ECFSetClockTimeScale(const UObject* WorldContextObject, FName Clock, float TimeScale = 1.f);
+
+	/**
+	 * Returns the time scale of the given clock.
+	 */
+	UFUNCTION(BlueprintPure, meta = (WorldContext = "WorldContextObject", DisplayName = "ECF - Get Clock Time Scale"), Category = "ECF")
+	static void ECFGetClockTimeScale(const UObject* WorldContextObject, FName Clock, float& TimeScale);
+
 	/**
 	 * Checks if the action pointed by given handle is running.
 	 */
@@ -3,10 +3,8 @@
 #pragma once
 
 #include "Coroutines/ECFCoroutineActionBase.h"
-#include "Templates/Atomic.h"
-#include "Async/Async.h"
+#include "ECFAsyncTask.h"
 #include "ECFTypes.h"
-#include "Async/TaskGraphInterfaces.h"
 #include "ECFRunAsyncAndWait.generated.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
@@ -20,55 +18,37 @@ class ENHANCEDCODEFLOW_API UECFRunAsyncAndWait: public UECFCoroutineActionBase
 
 protected:
 
-	TUniqueFunction<void()> AsyncTaskFunc;
+	FECFAsyncTask Task;
 	float TimeOut = 0.f;
 	float OriginTimeOut = 0.f;
 	bool bWithTimeOut = false;
 	bool bTimedOut = false;
 
-	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-	TAtomic<bool> bIsAsyncTaskDone = false;
-
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority)
+	bool Setup(FECFAsyncTaskFunc&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFAsyncPipe& InPipe)
 	{
-		AsyncTaskFunc = MoveTemp(InAsyncTaskFunc);
-
-		switch (InThreadPriority)
+		if (InAsyncTaskFunc)
 		{
-			case EECFAsyncPrio::Normal:
-				ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-				break;
-			case EECFAsyncPrio::HiPriority:
-				ThreadType = ENamedThreads::AnyBackgroundHiPriTask;
-				break;
+			SetupTimeOut(InTimeOut);
+			Task.Launch(MoveTemp(InAsyncTaskFunc), InThreadPriority, InPipe.ForOwner(Owner.Get()), GetCompletionNotifier());
+			return true;
 		}
-
-		if (AsyncTaskFunc)
+		else
 		{
-			if (InTimeOut > 0.f)
-			{
-				bWithTimeOut = true;
-				TimeOut = InTimeOut;
-				OriginTimeOut = InTimeOut;
-				SetMaxActionTime(TimeOut);
-			}
-			else
-			{
-				bWithTimeOut = false;
-			}
-
-			bIsAsyncTaskDone = false;
-
-			TWeakObjectPtr<ThisClass> WeakThis(this);
-			AsyncTask(ThreadType, [WeakThis]()
-			{
-				if (ThisClass* StrongThis = WeakThis.Get())
-				{
-					StrongThis->AsyncTaskFunc();
-					StrongThis->bIsAsyncTaskDone = true;
-				}
-			});
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - Run Async Task and Wait failed to start. Are you sure the AsyncTask function is set properly?"), *Settings.Label);
+#endif
+			return false;
+		}
+	}
 
+	// The callback of the task moves the result to the awaiter, before the coroutine is resumed.
+	template<typename T>
+	bool Setup(TECFAsyncResultTask<T>&& InAsyncTask, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFAsyncPipe& InPipe)
+	{
+		if (InAsyncTask.IsSet())
+		{
+			SetupTimeOut(InTimeOut);
+			Task.Launch(MoveTemp(InAsyncTask), InThreadPriority, InPipe.ForOwner(Owner.Get()), GetCompletionNotifier());
 			return true;
 		}
 		else
@@ -80,6 +60,21 @@ protected:
 		}
 	}
 
+	void SetupTimeOut(float InTimeOut)
+	{
+		if (InTimeOut > 0.f)
+		{
+			bWithTimeOut = true;
+			TimeOut = InTimeOut;
+			OriginTimeOut = InTimeOut;
+			SetMaxActionTime(TimeOut);
+		}
+		else
+		{
+			bWithTimeOut = false;
+		}
+	}
+
 	bool Reset(bool bCallUpdate) override
 	{
 		if (bWithTimeOut)
@@ -89,6 +84,24 @@ protected:
 		return true;
 	}
 
+	// The action is not ticked until the async task ends, or until the timeout passes.
+	bool IsWaitingForCompletion() const override
+	{
+		return Task.IsDone() == false;
+	}
+
+	// The timeout doesn't pass while the task waits in the queue of the executor. The action is woken up when the task starts.
+	float GetSleepTime() const override
+	{
+		return (bWithTimeOut && Task.IsStarted()) ? TimeOut : 0.f;
+	}
+
+	// The async task is not needed anymore - let it know it can stop.
+	void OnRemoved() override
+	{
+		Task.Reset();
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -99,19 +112,20 @@ protected:
 		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - RunAsyncAndWait Tick");
 #endif
 
-		if (bWithTimeOut)
+		if (bWithTimeOut && Task.IsStarted())
 		{
 			TimeOut -= DeltaTime;
 			if (TimeOut <= 0.f)
 			{
 				bTimedOut = true;
+				Task.Cancel();
 				MarkAsFinished();
 				Complete(false);
 				return;
 			}
 		}
 
-		if (bIsAsyncTaskDone)
+		if (Task.IsDone())
 		{
 			MarkAsFinished();
 			Complete(false);
@@ -120,6 +134,7 @@ protected:
 
 	void Complete(bool bStopped) override
 	{
+		Task.Complete(bTimedOut, bStopped);
 		CoroutineHandle.promise().bTimedOut = bTimedOut;
 		CoroutineHandle.promise().bStopped = bStopped;
 		CoroutineHandle.resume();
@@ -51,6 +51,14 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		Super::ResetForPool();
+		WaitTime = 0.f;
+		CurrentTime = 0.f;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -75,6 +83,11 @@ protected:
 		CoroutineHandle.resume();
 	}
 
+	float GetSleepTime() const override
+	{
+		return WaitTime - CurrentTime;
+	}
+
 	float GetActionTime() const override
 	{
 		return CurrentTime;
@@ -47,6 +47,14 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		Super::ResetForPool();
+		WaitTicks = 0;
+		CurrentTicks = 0;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -71,6 +79,16 @@ protected:
 		CoroutineHandle.resume();
 	}
 
+	int32 GetSleepTicks() const override
+	{
+		return WaitTicks - CurrentTicks;
+	}
+
+	void SkipTicks(int32 TicksNum) override
+	{
+		CurrentTicks += TicksNum;
+	}
+
 	float GetActionTime() const override
 	{
 		return (float)CurrentTicks;
@@ -85,6 +85,18 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		Super::ResetForPool();
+		Predicate = nullptr;
+		Predicate_NoDeltaTime = nullptr;
+		TimeOut = 0.f;
+		OriginTimeOut = 0.f;
+		bWithTimeOut = false;
+		bTimedOut = false;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
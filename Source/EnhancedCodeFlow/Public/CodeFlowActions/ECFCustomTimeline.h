@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "Components/TimelineComponent.h"
 #include "Curves/CurveFloat.h"
 #include "ECFCustomTimeline.generated.h"
@@ -19,8 +20,7 @@ class ENHANCEDCODEFLOW_API UECFCustomTimeline : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(float, float)> TickFunc;
-	TUniqueFunction<void(float, float, bool)> CallbackFunc;
-	TUniqueFunction<void(float, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(float, float, bool), void(float, float)> CallbackFunc;
 	FTimeline MyTimeline;
 
 	float CurrentValue = 0.f;
@@ -29,7 +29,7 @@ protected:
 	UPROPERTY(Transient)
 	UCurveFloat* CurveFloat = nullptr;
 
-	bool Setup(UCurveFloat* InCurveFloat, TUniqueFunction<void(float, float)>&& InTickFunc, TUniqueFunction<void(float, float, bool)>&& InCallbackFunc = nullptr)
+	bool Setup(UCurveFloat* InCurveFloat, TUniqueFunction<void(float, float)>&& InTickFunc, TECFCallback<void(float, float, bool), void(float, float)>&& InCallbackFunc = {})
 	{
 		TickFunc = MoveTemp(InTickFunc);
 		CallbackFunc = MoveTemp(InCallbackFunc);
@@ -52,18 +52,6 @@ protected:
 		}
 	}
 
-	bool Setup(UCurveFloat* InCurveFloat, TUniqueFunction<void(float, float)>&& InTickFunc, TUniqueFunction<void(float, float)>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InCurveFloat, MoveTemp(InTickFunc), [this](float Value, float Time, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(Value, Time);
-			}
-		});
-	}
-
 	void Init() override
 	{
 		CurrentTime = 0.f;
@@ -84,6 +72,17 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		TickFunc = nullptr;
+		CallbackFunc.Reset();
+		MyTimeline = FTimeline();
+		CurrentValue = 0.f;
+		CurrentTime = 0.f;
+		CurveFloat = nullptr;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "Components/TimelineComponent.h"
 #include "Curves/CurveLinearColor.h"
 #include "ECFCustomTimelineLinearColor.generated.h"
@@ -19,8 +20,7 @@ class ENHANCEDCODEFLOW_API UECFCustomTimelineLinearColor : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(FLinearColor, float)> TickFunc;
-	TUniqueFunction<void(FLinearColor, float, bool)> CallbackFunc;
-	TUniqueFunction<void(FLinearColor, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(FLinearColor, float, bool), void(FLinearColor, float)> CallbackFunc;
 	FTimeline MyTimeline;
 
 	FLinearColor CurrentValue = FLinearColor::Black;
@@ -29,7 +29,7 @@ protected:
 	UPROPERTY(Transient)
 	UCurveLinearColor* CurveLinearColor = nullptr;
 
-	bool Setup(UCurveLinearColor* InCurveLinearColor, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TUniqueFunction<void(FLinearColor, float, bool)>&& InCallbackFunc = nullptr)
+	bool Setup(UCurveLinearColor* InCurveLinearColor, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TECFCallback<void(FLinearColor, float, bool), void(FLinearColor, float)>&& InCallbackFunc = {})
 	{
 		TickFunc = MoveTemp(InTickFunc);
 		CallbackFunc = MoveTemp(InCallbackFunc);
@@ -52,18 +52,6 @@ protected:
 		}
 	}
 
-	bool Setup(UCurveLinearColor* InCurveLinearColor, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TUniqueFunction<void(FLinearColor, float)>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InCurveLinearColor, MoveTemp(InTickFunc), [this](FLinearColor Value, float Time, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(Value, Time);
-			}
-		});
-	}
-
 	void Init() override
 	{
 		CurrentTime = 0.f;
@@ -84,6 +72,17 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		TickFunc = nullptr;
+		CallbackFunc.Reset();
+		MyTimeline = FTimeline();
+		CurrentValue = FLinearColor::Black;
+		CurrentTime = 0.f;
+		CurveLinearColor = nullptr;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
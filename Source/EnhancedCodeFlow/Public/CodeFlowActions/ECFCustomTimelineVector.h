@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "Components/TimelineComponent.h"
 #include "Curves/CurveVector.h"
 #include "ECFCustomTimelineVector.generated.h"
@@ -19,8 +20,7 @@ class ENHANCEDCODEFLOW_API UECFCustomTimelineVector : public UECFActionBase
 protected:
 
 	TUniqueFunction<void(FVector, float)> TickFunc;
-	TUniqueFunction<void(FVector, float, bool)> CallbackFunc;
-	TUniqueFunction<void(FVector, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(FVector, float, bool), void(FVector, float)> CallbackFunc;
 	FTimeline MyTimeline;
 
 	FVector CurrentValue = FVector::ZeroVector;
@@ -29,7 +29,7 @@ protected:
 	UPROPERTY(Transient)
 	UCurveVector* CurveVector = nullptr;
 
-	bool Setup(UCurveVector* InCurveVector, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float, bool)>&& InCallbackFunc = nullptr)
+	bool Setup(UCurveVector* InCurveVector, TUniqueFunction<void(FVector, float)>&& InTickFunc, TECFCallback<void(FVector, float, bool), void(FVector, float)>&& InCallbackFunc = {})
 	{
 		TickFunc = MoveTemp(InTickFunc);
 		CallbackFunc = MoveTemp(InCallbackFunc);
@@ -52,18 +52,6 @@ protected:
 		}
 	}
 
-	bool Setup(UCurveVector* InCurveVector, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float)>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InCurveVector, MoveTemp(InTickFunc), [this](FVector Value, float Time, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(Value, Time);
-			}
-		});
-	}
-
 	void Init() override
 	{
 		CurrentTime = 0.f;
@@ -84,6 +72,17 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		TickFunc = nullptr;
+		CallbackFunc.Reset();
+		MyTimeline = FTimeline();
+		CurrentValue = FVector::ZeroVector;
+		CurrentTime = 0.f;
+		CurveVector = nullptr;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "ECFDelay.generated.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
@@ -16,12 +17,19 @@ class ENHANCEDCODEFLOW_API UECFDelay : public UECFActionBase
 
 protected:
 
-	TUniqueFunction<void(bool)> CallbackFunc;
-	TUniqueFunction<void()> CallbackFunc_NoStopped;
+	TECFCallback<void(bool), void()> CallbackFunc;
 	float DelayTime = 0.f;
-	float CurrentTime = 0.f;
 
-	bool Setup(float InDelayTime, TUniqueFunction<void(bool)>&& InCallbackFunc)
+	// Lane time at which the delay started. The time is measured against the lane, so it doesn't drift
+	// from summing up the delta times. The first delay of the action is skipped by starting later.
+	double StartLaneTime = 0.0;
+
+	float GetElapsedTime() const
+	{
+		return static_cast<float>(GetActiveLaneTime() - StartLaneTime);
+	}
+
+	bool Setup(float InDelayTime, TECFCallback<void(bool), void()>&& InCallbackFunc)
 	{
 		DelayTime = InDelayTime;
 		CallbackFunc = MoveTemp(InCallbackFunc);
@@ -43,33 +51,22 @@ protected:
 		}
 	}
 
-	bool Setup(float InDelayTime, TUniqueFunction<void()>&& InCallbackFunc)
+	void Init() override
 	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		if (CallbackFunc_NoStopped)
-		{
-			return Setup(InDelayTime, [this](bool bStopped)
-			{
-				CallbackFunc_NoStopped();
-			});			
-		}
-		else
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] delay failed to start. Are you sure the Callback Function is set properly?"), *Settings.Label);
-#endif
-			return false;
-		}
+		StartLaneTime = GetActiveLaneTime() + Settings.FirstDelay;
 	}
 
-	void Init() override
+	bool Reset(bool bCallUpdate) override
 	{
-		CurrentTime = 0;
+		StartLaneTime = GetActiveLaneTime();
+		return true;
 	}
 
-	bool Reset(bool bCallUpdate) override
+	bool ResetForPool() override
 	{
-		CurrentTime = 0;
+		CallbackFunc.Reset();
+		DelayTime = 0.f;
+		StartLaneTime = 0.0;
 		return true;
 	}
 
@@ -83,8 +80,7 @@ protected:
 		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - Delay Tick");
 #endif
 
-		CurrentTime += DeltaTime;
-		if (CurrentTime > DelayTime)
+		if (GetElapsedTime() > DelayTime)
 		{
 			MarkAsFinished();
 			Complete(false);
@@ -96,17 +92,22 @@ protected:
 		CallbackFunc(bStopped);
 	}
 
+	float GetSleepTime() const override
+	{
+		return DelayTime - GetElapsedTime();
+	}
+
 	float GetActionTime() const override
 	{
-		return CurrentTime;
+		return FMath::Max(GetElapsedTime(), 0.f);
 	}
 
 	bool SetActionTime(float NewTime, bool bCallUpdate) override
 	{
-		CurrentTime = NewTime;
+		StartLaneTime = GetActiveLaneTime() - NewTime;
 		if (bCallUpdate)
 		{
-			if (CurrentTime > DelayTime)
+			if (NewTime > DelayTime)
 			{
 				MarkAsFinished();
 				Complete(false);
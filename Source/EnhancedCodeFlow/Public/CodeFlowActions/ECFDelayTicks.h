@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "ECFDelayTicks.generated.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
@@ -16,12 +17,11 @@ class ENHANCEDCODEFLOW_API UECFDelayTicks : public UECFActionBase
 
 protected:
 
-	TUniqueFunction<void(bool)> CallbackFunc;
-	TUniqueFunction<void()> CallbackFunc_NoStopped;
+	TECFCallback<void(bool), void()> CallbackFunc;
 	int32 DelayTicks = 0;
 	int32 CurrentTicks = 0;
 
-	bool Setup(int32 InDelayTicks, TUniqueFunction<void(bool)>&& InCallbackFunc)
+	bool Setup(int32 InDelayTicks, TECFCallback<void(bool), void()>&& InCallbackFunc)
 	{
 		DelayTicks = InDelayTicks;
 		CallbackFunc = MoveTemp(InCallbackFunc);
@@ -39,32 +39,21 @@ protected:
 		}
 	}
 
-	bool Setup(int32 InDelayTicks, TUniqueFunction<void()>&& InCallbackFunc)
+	void Init() override
 	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		if (CallbackFunc_NoStopped)
-		{
-			return Setup(InDelayTicks, [this](bool bStopped)
-			{
-				CallbackFunc_NoStopped();
-			});
-		}
-		else
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - delay ticks failed to start. Are you sure the Callback Function is set properly?"));
-#endif
-			return false;
-		}
+		CurrentTicks = 0;
 	}
 
-	void Init() override
+	bool Reset(bool bCallUpdate) override
 	{
 		CurrentTicks = 0;
+		return true;
 	}
 
-	bool Reset(bool bCallUpdate) override
+	bool ResetForPool() override
 	{
+		CallbackFunc.Reset();
+		DelayTicks = 0;
 		CurrentTicks = 0;
 		return true;
 	}
@@ -92,6 +81,16 @@ protected:
 		CallbackFunc(bStopped);
 	}
 
+	int32 GetSleepTicks() const override
+	{
+		return DelayTicks - CurrentTicks;
+	}
+
+	void SkipTicks(int32 TicksNum) override
+	{
+		CurrentTicks += TicksNum;
+	}
+
 	float GetActionTime() const override
 	{
 		return (float)CurrentTicks;
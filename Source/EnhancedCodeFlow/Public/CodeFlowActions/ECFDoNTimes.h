@@ -14,6 +14,11 @@ class ENHANCEDCODEFLOW_API UECFDoNTimes : public UECFActionBase
 
 	friend class UECFSubsystem;
 
+public:
+
+	// This action is never ticked, it only reacts to being retriggered.
+	static constexpr bool bIsEventOnly = true;
+
 protected:
 
 	TUniqueFunction<void(int32)> ExecFunc;
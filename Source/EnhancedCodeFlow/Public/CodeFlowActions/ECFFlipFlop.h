@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "ECFActionBase.h"
+#include "ECFFlipFlop.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFFlipFlop : public UECFActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+public:
+
+	// This action is never ticked, it only reacts to being retriggered.
+	static constexpr bool bIsEventOnly = true;
+
+protected:
+
+	TUniqueFunction<void(bool)> ExecFunc;
+	bool bIsA = true;
+
+	bool Setup(TUniqueFunction<void(bool)>&& InExecFunc)
+	{
+		ExecFunc = MoveTemp(InExecFunc);
+
+		if (ExecFunc)
+		{
+			return true;
+		}
+		else
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Flip Flop failed to start. Are you sure the Exec Function is set properly?"), *Settings.Label);
+#endif
+			return false;
+		}
+	}
+
+	void Init() override
+	{
+		bIsA = true;
+		RetriggeredInstancedAction();
+	}
+
+	bool Reset(bool bCallUpdate) override
+	{
+		bIsA = true;
+		return true;
+	}
+
+	void RetriggeredInstancedAction() override
+	{
+		const bool bWasA = bIsA;
+		bIsA = !bIsA;
+		ExecFunc(bWasA);
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "ECFActionBase.h"
+#include "ECFGate.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFGate : public UECFActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+public:
+
+	// This action is never ticked, it only reacts to being retriggered.
+	static constexpr bool bIsEventOnly = true;
+
+	// Opens the gate, so the next entering will execute the function.
+	void Open()
+	{
+		bIsOpen = true;
+	}
+
+	// Closes the gate, so the next entering will not execute the function.
+	void Close()
+	{
+		bIsOpen = false;
+	}
+
+	// Opens the closed gate or closes the opened one.
+	void Toggle()
+	{
+		bIsOpen = !bIsOpen;
+	}
+
+	// Checks if the gate is open.
+	bool IsOpen() const
+	{
+		return bIsOpen;
+	}
+
+protected:
+
+	TUniqueFunction<void()> ExecFunc;
+	bool bStartClosed = false;
+	bool bIsOpen = true;
+
+	bool Setup(TUniqueFunction<void()>&& InExecFunc, bool bInStartClosed)
+	{
+		ExecFunc = MoveTemp(InExecFunc);
+		bStartClosed = bInStartClosed;
+
+		if (ExecFunc)
+		{
+			return true;
+		}
+		else
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Gate failed to start. Are you sure the Exec Function is set properly?"), *Settings.Label);
+#endif
+			return false;
+		}
+	}
+
+	void Init() override
+	{
+		bIsOpen = (bStartClosed == false);
+		RetriggeredInstancedAction();
+	}
+
+	bool Reset(bool bCallUpdate) override
+	{
+		bIsOpen = (bStartClosed == false);
+		return true;
+	}
+
+	void RetriggeredInstancedAction() override
+	{
+		if (bIsOpen)
+		{
+			ExecFunc();
+		}
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
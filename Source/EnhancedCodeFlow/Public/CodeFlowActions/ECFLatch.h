@@ -0,0 +1,72 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "ECFActionBase.h"
+#include "ECFLatch.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFLatch : public UECFActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+public:
+
+	// This action is never ticked, it only reacts to being retriggered.
+	static constexpr bool bIsEventOnly = true;
+
+protected:
+
+	TUniqueFunction<void()> ExecFunc;
+	uint32 Count = 0;
+	uint32 Counter = 0;
+
+	bool Setup(uint32 InCount, TUniqueFunction<void()>&& InExecFunc)
+	{
+		Count = InCount;
+		ExecFunc = MoveTemp(InExecFunc);
+
+		if (ExecFunc && Count > 0)
+		{
+			return true;
+		}
+		else
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Latch failed to start. Are you sure the Exec Function and the Count are set properly?"), *Settings.Label);
+#endif
+			return false;
+		}
+	}
+
+	void Init() override
+	{
+		Counter = 0;
+		RetriggeredInstancedAction();
+	}
+
+	bool Reset(bool bCallUpdate) override
+	{
+		Counter = 0;
+		return true;
+	}
+
+	void RetriggeredInstancedAction() override
+	{
+		// Count down to the release and ignore any calls after it, until the latch is reset.
+		if (Counter < Count)
+		{
+			Counter++;
+			if (Counter == Count)
+			{
+				ExecFunc();
+			}
+		}
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
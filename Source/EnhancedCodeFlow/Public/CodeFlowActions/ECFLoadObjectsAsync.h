@@ -74,10 +74,12 @@ protected:
 
 	void Init() override
 	{
+		// The action is not ticked while loading, so notify the completion to remove it right after it's finished.
 		TWeakObjectPtr<ThisClass> WeakThis(this);
+		const FECFCompletionNotifier CompletionNotifier = GetCompletionNotifier();
 		FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
 		StreamableHandle = StreamableManager.RequestAsyncLoad(ObjectsToLoad,
-			[WeakThis]()
+			[WeakThis, CompletionNotifier]()
 			{
 				if (ThisClass* StrongThis = WeakThis.Get())
 				{
@@ -90,10 +92,17 @@ protected:
 						StrongThis->Complete(false);
 					}
 				}
+				CompletionNotifier.Notify();
 			}
 		);
 	}
 
+	// Loading ends with the callback of the streamable manager, so there is nothing to tick.
+	bool IsWaitingForCompletion() const override
+	{
+		return true;
+	}
+
 	void Complete(bool bStopped) override
 	{
 		if (StreamableHandle.IsValid())
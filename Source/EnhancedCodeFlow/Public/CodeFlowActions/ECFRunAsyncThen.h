@@ -3,10 +3,10 @@
 #pragma once
 
 #include "ECFActionBase.h"
-#include "Templates/Atomic.h"
-#include "Async/Async.h"
+#include "ECFAsyncTask.h"
+#include "ECFAsyncPipeline.h"
+#include "ECFCallback.h"
 #include "ECFTypes.h"
-#include "Async/TaskGraphInterfaces.h"
 #include "ECFRunAsyncThen.generated.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
@@ -20,62 +20,22 @@ class ENHANCEDCODEFLOW_API UECFRunAsyncThen : public UECFActionBase
 
 protected:
 
-	TUniqueFunction<void()> AsyncTaskFunc;
-	TUniqueFunction<void(bool, bool)> Func;
-	TUniqueFunction<void(bool)> Func_NoStopped;
-	TUniqueFunction<void()> Func_NoTimeOut_NoStopped;
+	FECFAsyncTask Task;
+	TECFCallback<void(bool, bool), void(bool), void()> Func;
 
 	float TimeOut = 0.f;
 	float OriginTimeOut = 0.f;
 	bool bWithTimeOut = false;
 	bool bTimedOut = false;
 
-	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-	TAtomic<bool> bIsAsyncTaskDone = false;
-
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool, bool)>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	bool Setup(FECFAsyncTaskFunc&& InAsyncTaskFunc, TECFCallback<void(bool, bool), void(bool), void()>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority, const FECFAsyncPipe& Pipe)
 	{
-		AsyncTaskFunc = MoveTemp(InAsyncTaskFunc);
 		Func = MoveTemp(InFunc);
 
-		switch (ThreadPriority)
-		{
-			case EECFAsyncPrio::Normal:
-				ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-				break;
-			case EECFAsyncPrio::HiPriority:
-				ThreadType = ENamedThreads::AnyBackgroundHiPriTask;
-				break;
-		}
-
-		if (AsyncTaskFunc && Func)
+		if (InAsyncTaskFunc && Func)
 		{
-			if (InTimeOut > 0.f)	
-			{
-				bWithTimeOut = true;
-				bTimedOut = false;
-				TimeOut = InTimeOut;
-				OriginTimeOut = InTimeOut;
-				SetMaxActionTime(TimeOut);
-			}
-			else
-			{
-				bWithTimeOut = false;
-				bTimedOut = false;
-			}
-
-			bIsAsyncTaskDone = false;
-
-			TWeakObjectPtr<ThisClass> WeakThis(this);
-			AsyncTask(ThreadType, [WeakThis]()
-			{
-				if (ThisClass* StrongThis = WeakThis.Get())
-				{
-					StrongThis->AsyncTaskFunc();
-					StrongThis->bIsAsyncTaskDone = true;
-				}
-			});
-
+			SetupTimeOut(InTimeOut);
+			Task.Launch(MoveTemp(InAsyncTaskFunc), ThreadPriority, Pipe.ForOwner(Owner.Get()), GetCompletionNotifier());
 			return true;
 		}
 		else
@@ -87,44 +47,62 @@ protected:
 		}
 	}
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool)>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	// The whole pipeline runs on workers and only the callback is called on the Game Thread.
+	bool Setup(FECFAsyncPipeline&& InPipeline, TECFCallback<void(bool, bool), void(bool), void()>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
 	{
-		Func_NoStopped = MoveTemp(InFunc);
-		if (Func_NoStopped)
+		Func = MoveTemp(InFunc);
+
+		if (InPipeline.IsValid() && Func)
 		{
-			return Setup(MoveTemp(InAsyncTaskFunc), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoStopped(bTimeOut);
-			}, InTimeOut, ThreadPriority);
+			SetupTimeOut(InTimeOut);
+			Task.Launch(MoveTemp(InPipeline), ThreadPriority, GetCompletionNotifier());
+			return true;
 		}
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Task and Run failed to start. Are you sure the Function is set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Pipeline failed to start. Are you sure the Pipeline and Function are set properly?"), *Settings.Label);
 #endif
 			return false;
 		}
 	}
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	// The result of the task is passed to the callback of the task, so the action doesn't keep any callback itself.
+	template<typename T>
+	bool Setup(TECFAsyncResultTask<T>&& InAsyncTask, float InTimeOut, EECFAsyncPrio ThreadPriority, const FECFAsyncPipe& Pipe)
 	{
-		Func_NoTimeOut_NoStopped = MoveTemp(InFunc);
-		if (Func_NoTimeOut_NoStopped)
+		if (InAsyncTask.IsSet())
 		{
-			return Setup(MoveTemp(InAsyncTaskFunc), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoTimeOut_NoStopped();
-			}, InTimeOut, ThreadPriority);
+			SetupTimeOut(InTimeOut);
+			Task.Launch(MoveTemp(InAsyncTask), ThreadPriority, Pipe.ForOwner(Owner.Get()), GetCompletionNotifier());
+			return true;
 		}
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Task and Run failed to start. Are you sure the Function is set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Task and Run failed to start. Are you sure the AsyncTask and Function are set properly?"), *Settings.Label);
 #endif
 			return false;
 		}
 	}
 
+	void SetupTimeOut(float InTimeOut)
+	{
+		if (InTimeOut > 0.f)
+		{
+			bWithTimeOut = true;
+			bTimedOut = false;
+			TimeOut = InTimeOut;
+			OriginTimeOut = InTimeOut;
+			SetMaxActionTime(TimeOut);
+		}
+		else
+		{
+			bWithTimeOut = false;
+			bTimedOut = false;
+		}
+	}
+
 	bool Reset(bool bCallUpdate) override
 	{
 		if (bWithTimeOut)
@@ -134,6 +112,35 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		Task.Reset();
+		Func.Reset();
+		TimeOut = 0.f;
+		OriginTimeOut = 0.f;
+		bWithTimeOut = false;
+		bTimedOut = false;
+		return true;
+	}
+
+	// The action is not ticked until the async task ends, or until the timeout passes.
+	bool IsWaitingForCompletion() const override
+	{
+		return Task.IsDone() == false;
+	}
+
+	// The timeout doesn't pass while the task waits in the queue of the executor. The action is woken up when the task starts.
+	float GetSleepTime() const override
+	{
+		return (bWithTimeOut && Task.IsStarted()) ? TimeOut : 0.f;
+	}
+
+	// The async task is not needed anymore - let it know it can stop.
+	void OnRemoved() override
+	{
+		Task.Reset();
+	}
+
 	void Tick(float DeltaTime) override 
 	{
 #if STATS
@@ -144,19 +151,20 @@ protected:
 		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - RunAsyncThen Tick");
 #endif
 
-		if (bWithTimeOut)
+		if (bWithTimeOut && Task.IsStarted())
 		{
 			TimeOut -= DeltaTime;
 			if (TimeOut <= 0.f)
 			{
 				bTimedOut = true;
+				Task.Cancel();
 				MarkAsFinished();
 				Complete(false);
 				return;
 			}
 		}
 
-		if (bIsAsyncTaskDone)
+		if (Task.IsDone())
 		{
 			MarkAsFinished();
 			Complete(false);
@@ -165,7 +173,11 @@ protected:
 
 	void Complete(bool bStopped) override
 	{
-		Func(bTimedOut, bStopped);
+		Task.Complete(bTimedOut, bStopped);
+		if (Func)
+		{
+			Func(bTimedOut, bStopped);
+		}
 	}
 };
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "ECFTicker.generated.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
@@ -14,17 +15,19 @@ class ENHANCEDCODEFLOW_API UECFTicker : public UECFActionBase
 
 	friend class UECFSubsystem;
 
+public:
+
+	// Ticks only call the tick function, so they can run in parallel when the tick function is thread-safe.
+	static constexpr bool bSupportsThreadSafeTick = true;
+
 protected:
 
-	TUniqueFunction<void(float, FECFHandle)> TickFunc;
-	TUniqueFunction<void(float)> TickFunc_NoHandle;
-	TUniqueFunction<void(bool)> CallbackFunc;
-	TUniqueFunction<void()> CallbackFunc_NoStopped;
+	TECFCallback<void(float, FECFHandle), void(float)> TickFunc;
+	TECFCallback<void(bool), void()> CallbackFunc;
 	float TickingTime = 0.f;
 	float CurrentTime = 0.f;
 
-	// Handle - yes, bStopped - yes
-	bool Setup(float InTickingTime, TUniqueFunction<void(float, FECFHandle)>&& InTickFunc, TUniqueFunction<void(bool)>&& InCallbackFunc = nullptr)
+	bool Setup(float InTickingTime, TECFCallback<void(float, FECFHandle), void(float)>&& InTickFunc, TECFCallback<void(bool), void()>&& InCallbackFunc = {})
 	{
 		TickingTime = InTickingTime;
 		TickFunc = MoveTemp(InTickFunc);
@@ -49,52 +52,6 @@ protected:
 		}
 	}
 
-	// Handle - yes, bStopped - no
-	bool Setup(float InTickingTime, TUniqueFunction<void(float, FECFHandle)>&& InTickFunc, TUniqueFunction<void()>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InTickingTime, MoveTemp(InTickFunc), [this](bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped();
-			}
-		});
-	}
-
-	// Handle - no, bStopped - yes
-	bool Setup(float InTickingTime, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void(bool)>&& InCallbackFunc = nullptr)
-	{
-		TickFunc_NoHandle = MoveTemp(InTickFunc);
-		return Setup(InTickingTime, [this](float DeltaTime, FECFHandle Handle) 
-		{
-			if (TickFunc_NoHandle)
-			{
-				TickFunc_NoHandle(DeltaTime);
-			}
-		}, MoveTemp(InCallbackFunc));
-	}
-
-	// Handle - no, bStopped - no
-	bool Setup(float InTickingTime, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void()>&& InCallbackFunc = nullptr)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		TickFunc_NoHandle = MoveTemp(InTickFunc);
-		return Setup(InTickingTime, [this](float DeltaTime, FECFHandle Handle)
-		{
-			if (TickFunc_NoHandle)
-			{
-				TickFunc_NoHandle(DeltaTime);
-			}
-		}, [this](bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped();
-			}
-		});
-	}
-
 	void Init() override
 	{
 		CurrentTime = 0.f;
@@ -109,6 +66,15 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		TickFunc.Reset();
+		CallbackFunc.Reset();
+		TickingTime = 0.f;
+		CurrentTime = 0.f;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -124,8 +90,7 @@ protected:
 
 		if (TickingTime > 0.f && CurrentTime >= TickingTime)
 		{
-			MarkAsFinished();
-			Complete(false);
+			FinishAndComplete();
 		}
 	}
 
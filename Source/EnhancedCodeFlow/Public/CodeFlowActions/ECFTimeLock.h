@@ -51,6 +51,14 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		ExecFunc = nullptr;
+		LockTime = 0.f;
+		CurrentTime = 0.f;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -68,6 +76,11 @@ protected:
 		}
 	}
 
+	float GetSleepTime() const override
+	{
+		return LockTime - CurrentTime;
+	}
+
 	float GetActionTime() const override
 	{
 		return CurrentTime;
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "ECFTypes.h"
 #include "ECFTimeline.generated.h"
 
@@ -15,6 +16,11 @@ class ENHANCEDCODEFLOW_API UECFTimeline : public UECFActionBase
 
 	friend class UECFSubsystem;
 
+public:
+
+	// Ticks only call the tick function, so they can run in parallel when the tick function is thread-safe.
+	static constexpr bool bSupportsThreadSafeTick = true;
+
 private:
 	
 	float GetValue()
@@ -37,9 +43,8 @@ private:
 
 protected:
 
-	TUniqueFunction<void(float, float)> TickFunc;
-	TUniqueFunction<void(float, float, bool)> CallbackFunc;
-	TUniqueFunction<void(float, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(float, float)> TickFunc;
+	TECFCallback<void(float, float, bool), void(float, float)> CallbackFunc;
 	float StartValue;
 	float StopValue;
 	float Time;
@@ -49,7 +54,7 @@ protected:
 	float CurrentTime;
 	float CurrentValue;
 
-	bool Setup(float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float, float)>&& InTickFunc, TUniqueFunction<void(float, float, bool)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
+	bool Setup(float InStartValue, float InStopValue, float InTime, TECFCallback<void(float, float)>&& InTickFunc, TECFCallback<void(float, float, bool), void(float, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
 	{
 		StartValue = InStartValue;
 		StopValue = InStopValue;
@@ -76,18 +81,6 @@ protected:
 		}
 	}
 
-	bool Setup(float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float, float)>&& InTickFunc, TUniqueFunction<void(float, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InStartValue, InStopValue, InTime, MoveTemp(InTickFunc), [this](float FwdValue, float FwdTime, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(FwdValue, FwdTime);
-			}
-		}, InBlendFunc, InBlendExp);
-	}
-
 	bool Reset(bool bCallUpdate) override
 	{
 		CurrentTime = 0.f;
@@ -101,6 +94,20 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		TickFunc.Reset();
+		CallbackFunc.Reset();
+		StartValue = 0.f;
+		StopValue = 0.f;
+		Time = 0.f;
+		BlendFunc = EECFBlendFunc::ECFBlend_Linear;
+		BlendExp = 0.f;
+		CurrentTime = 0.f;
+		CurrentValue = 0.f;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -118,8 +125,7 @@ protected:
 
 		if (CurrentTime >= Time)
 		{
-			MarkAsFinished();
-			Complete(false);
+			FinishAndComplete();
 		}
 	}
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "ECFTypes.h"
 #include "ECFTimelineLinearColor.generated.h"
 
@@ -15,6 +16,11 @@ class ENHANCEDCODEFLOW_API UECFTimelineLinearColor: public UECFActionBase
 
 	friend class UECFSubsystem;
 
+public:
+
+	// Ticks only call the tick function, so they can run in parallel when the tick function is thread-safe.
+	static constexpr bool bSupportsThreadSafeTick = true;
+
 private:
 
 	FLinearColor GetValue()
@@ -37,9 +43,8 @@ private:
 
 protected:
 
-	TUniqueFunction<void(FLinearColor, float)> TickFunc;
-	TUniqueFunction<void(FLinearColor, float, bool)> CallbackFunc;
-	TUniqueFunction<void(FLinearColor, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(FLinearColor, float)> TickFunc;
+	TECFCallback<void(FLinearColor, float, bool), void(FLinearColor, float)> CallbackFunc;
 	FLinearColor StartValue;
 	FLinearColor StopValue;
 	float Time;
@@ -49,7 +54,7 @@ protected:
 	float CurrentTime;
 	FLinearColor CurrentValue;
 
-	bool Setup(FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TUniqueFunction<void(FLinearColor, float, bool)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
+	bool Setup(FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TECFCallback<void(FLinearColor, float)>&& InTickFunc, TECFCallback<void(FLinearColor, float, bool), void(FLinearColor, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
 	{
 		StartValue = InStartValue;
 		StopValue = InStopValue;
@@ -76,18 +81,6 @@ protected:
 		}
 	}
 
-	bool Setup(FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TUniqueFunction<void(FLinearColor, float)>&& InTickFunc, TUniqueFunction<void(FLinearColor, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InStartValue, InStopValue, InTime, MoveTemp(InTickFunc), [this](FLinearColor FwdValue, float FwdTime, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(FwdValue, FwdTime);
-			}
-		}, InBlendFunc, InBlendExp);
-	}
-
 	bool Reset(bool bCallUpdate) override
 	{
 		CurrentTime = 0.f;
@@ -101,6 +94,20 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		TickFunc.Reset();
+		CallbackFunc.Reset();
+		StartValue = FLinearColor::Black;
+		StopValue = FLinearColor::Black;
+		Time = 0.f;
+		BlendFunc = EECFBlendFunc::ECFBlend_Linear;
+		BlendExp = 0.f;
+		CurrentTime = 0.f;
+		CurrentValue = FLinearColor::Black;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -118,8 +125,7 @@ protected:
 
 		if (CurrentTime >= Time)
 		{
-			MarkAsFinished();
-			Complete(false);
+			FinishAndComplete();
 		}
 	}
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "ECFTypes.h"
 #include "ECFTimelineVector.generated.h"
 
@@ -15,6 +16,11 @@ class ENHANCEDCODEFLOW_API UECFTimelineVector : public UECFActionBase
 
 	friend class UECFSubsystem;
 
+public:
+
+	// Ticks only call the tick function, so they can run in parallel when the tick function is thread-safe.
+	static constexpr bool bSupportsThreadSafeTick = true;
+
 private:
 
 	FVector GetValue()
@@ -37,9 +43,8 @@ private:
 
 protected:
 
-	TUniqueFunction<void(FVector, float)> TickFunc;
-	TUniqueFunction<void(FVector, float, bool)> CallbackFunc;
-	TUniqueFunction<void(FVector, float)> CallbackFunc_NoStopped;
+	TECFCallback<void(FVector, float)> TickFunc;
+	TECFCallback<void(FVector, float, bool), void(FVector, float)> CallbackFunc;
 	FVector StartValue;
 	FVector StopValue;
 	float Time;
@@ -49,7 +54,7 @@ protected:
 	float CurrentTime;
 	FVector CurrentValue;
 
-	bool Setup(FVector InStartValue, FVector InStopValue, float InTime, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float, bool)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
+	bool Setup(FVector InStartValue, FVector InStopValue, float InTime, TECFCallback<void(FVector, float)>&& InTickFunc, TECFCallback<void(FVector, float, bool), void(FVector, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
 	{
 		StartValue = InStartValue;
 		StopValue = InStopValue;
@@ -76,18 +81,6 @@ protected:
 		}
 	}
 
-	bool Setup(FVector InStartValue, FVector InStopValue, float InTime, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
-	{
-		CallbackFunc_NoStopped = MoveTemp(InCallbackFunc);
-		return Setup(InStartValue, InStopValue, InTime, MoveTemp(InTickFunc), [this](FVector FwdValue, float FwdTime, bool bStopped)
-		{
-			if (CallbackFunc_NoStopped)
-			{
-				CallbackFunc_NoStopped(FwdValue, FwdTime);
-			}
-		}, InBlendFunc, InBlendExp);
-	}
-
 	bool Reset(bool bCallUpdate) override
 	{
 		CurrentTime = 0.f;
@@ -101,6 +94,20 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		TickFunc.Reset();
+		CallbackFunc.Reset();
+		StartValue = FVector::ZeroVector;
+		StopValue = FVector::ZeroVector;
+		Time = 0.f;
+		BlendFunc = EECFBlendFunc::ECFBlend_Linear;
+		BlendExp = 0.f;
+		CurrentTime = 0.f;
+		CurrentValue = FVector::ZeroVector;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -118,8 +125,7 @@ protected:
 
 		if (CurrentTime >= Time)
 		{
-			MarkAsFinished();
-			Complete(false);
+			FinishAndComplete();
 		}
 	}
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "ECFWaitAndExecute.generated.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
@@ -16,21 +17,15 @@ class ENHANCEDCODEFLOW_API UECFWaitAndExecute : public UECFActionBase
 
 protected:
 
-	TUniqueFunction<bool(float)> Predicate;
-	TUniqueFunction<bool()> Predicate_NoDeltaTime;
-	TUniqueFunction<void(bool, bool)> Func;
-	TUniqueFunction<void(bool)> Func_NoStopped;
-	TUniqueFunction<void()> Func_NoTimeOut_NoStopped;
+	TECFCallback<bool(float), bool()> Predicate;
+	TECFCallback<void(bool, bool), void(bool), void()> Func;
 
 	float TimeOut = 0.f;
 	float OriginTimeOut = 0.f;
 	bool bWithTimeOut = false;
 	bool bTimedOut = false;
 
-	// Predicate DeltaTime - YES
-	// Callback bStopped - YES
-	// Callback bTimedOut - YES
-	bool Setup(TUniqueFunction<bool(float)>&& InPredicate, TUniqueFunction<void(bool, bool)>&& InFunc, float InTimeOut)
+	bool Setup(TECFCallback<bool(float), bool()>&& InPredicate, TECFCallback<void(bool, bool), void(bool), void()>&& InFunc, float InTimeOut)
 	{
 		Predicate = MoveTemp(InPredicate);
 		Func = MoveTemp(InFunc);
@@ -66,126 +61,6 @@ protected:
 		}
 	}
 
-	// Predicate DeltaTime - NO
-	// Callback bStopped - YES
-	// Callback bTimedOut - YES
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(bool, bool)>&& InFunc, float InTimeOut)
-	{
-		Predicate_NoDeltaTime = MoveTemp(InPredicate);
-		if (Predicate_NoDeltaTime)
-		{
-			return Setup([this](float DeltaTime)
-			{
-				return Predicate_NoDeltaTime();
-			}, MoveTemp(InFunc), InTimeOut);
-		}
-		else
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Wait and Execute failed to start. Are you sure the Function is set properly?"), *Settings.Label);
-#endif
-			return false;
-		}
-	}
-
-	// Predicate DeltaTime - YES
-	// Callback bStopped - NO
-	// Callback bTimedOut - YES
-	bool Setup(TUniqueFunction<bool(float)>&& InPredicate, TUniqueFunction<void(bool)>&& InFunc, float InTimeOut)
-	{
-		Func_NoStopped = MoveTemp(InFunc);
-		if (Func_NoStopped)
-		{
-			return Setup(MoveTemp(InPredicate), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoStopped(bTimeOut);
-			}, InTimeOut);
-		}
-		else
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Wait and Execute failed to start. Are you sure the Function is set properly?"), *Settings.Label);
-#endif
-			return false;
-		}
-	}
-
-	// Predicate DeltaTime - NO
-	// Callback bStopped - NO
-	// Callback bTimedOut - YES
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(bool)>&& InFunc, float InTimeOut)
-	{
-		Func_NoStopped = MoveTemp(InFunc);
-		Predicate_NoDeltaTime = MoveTemp(InPredicate);
-		if (Func_NoStopped && Predicate_NoDeltaTime)
-		{
-			return Setup([this](float DeltaTime)
-				{
-					return Predicate_NoDeltaTime();
-				},
-				[this](bool bTimeOut, bool bStopped)
-				{
-					Func_NoStopped(bTimeOut);
-				}, InTimeOut);
-		}
-		else
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Wait and Execute failed to start. Are you sure the Function is set properly?"), *Settings.Label);
-#endif
-			return false;
-		}
-	}
-
-	// Predicate DeltaTime - YES
-	// Callback bStopped - NO
-	// Callback bTimedOut - NO
-	bool Setup(TUniqueFunction<bool(float)>&& InPredicate, TUniqueFunction<void()>&& InFunc, float InTimeOut)
-	{
-		Func_NoTimeOut_NoStopped = MoveTemp(InFunc);
-		if (Func_NoTimeOut_NoStopped)
-		{
-			return Setup(MoveTemp(InPredicate), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoTimeOut_NoStopped();
-			}, InTimeOut);
-		}
-		else
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Wait and Execute failed to start. Are you sure the Function is set properly?"), *Settings.Label);
-#endif
-			return false;
-		}
-	}
-
-	// Predicate DeltaTime - NO
-	// Callback bStopped - NO
-	// Callback bTimedOut - NO
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void()>&& InFunc, float InTimeOut)
-	{
-		Func_NoTimeOut_NoStopped = MoveTemp(InFunc);
-		Predicate_NoDeltaTime = MoveTemp(InPredicate);
-		if (Func_NoTimeOut_NoStopped && Predicate_NoDeltaTime)
-		{
-			return Setup([this](float DeltaTime)
-			{
-				return Predicate_NoDeltaTime();
-			},
-			[this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoTimeOut_NoStopped();
-			}, InTimeOut);
-		}
-		else
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Wait and Execute failed to start. Are you sure the Function is set properly?"), *Settings.Label);
-#endif
-			return false;
-		}
-	}
-
 	bool Reset(bool bCallUpdate) override
 	{
 		if (bWithTimeOut)
@@ -195,6 +70,17 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		Predicate.Reset();
+		Func.Reset();
+		TimeOut = 0.f;
+		OriginTimeOut = 0.f;
+		bWithTimeOut = false;
+		bTimedOut = false;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override 
 	{
 #if STATS
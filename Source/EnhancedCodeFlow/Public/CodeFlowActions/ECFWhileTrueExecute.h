@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFCallback.h"
 #include "ECFWhileTrueExecute.generated.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
@@ -18,16 +19,14 @@ protected:
 
 	TUniqueFunction<bool()> Predicate;
 	TUniqueFunction<void(float)> TickFunc;
-	TUniqueFunction<void(bool, bool)> CompleteFunc;
-	TUniqueFunction<void(bool)> CompleteFunc_NoStopped;
-	TUniqueFunction<void()> CompleteFunc_NoTimeOut_NoStopped;
+	TECFCallback<void(bool, bool), void(bool), void()> CompleteFunc;
 
 	float TimeOut = 0.f;
 	float OriginTimeOut = 0.f;
 	bool bWithTimeOut = false;
 	bool bTimedOut = false;
 
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void(bool, bool)>&& InCompleteFunc, float InTimeOut)
+	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, TECFCallback<void(bool, bool), void(bool), void()>&& InCompleteFunc, float InTimeOut)
 	{
 		Predicate = MoveTemp(InPredicate);
 		TickFunc = MoveTemp(InTickFunc);
@@ -67,30 +66,6 @@ protected:
 		}
 	}
 
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void(bool)>&& InCompleteFunc, float InTimeOut)
-	{
-		CompleteFunc_NoStopped = MoveTemp(InCompleteFunc);
-		return Setup(MoveTemp(InPredicate), MoveTemp(InTickFunc), [this](bool bTimeOut, bool bStopped)
-		{
-			if (CompleteFunc_NoStopped)
-			{
-				CompleteFunc_NoStopped(bTimeOut);
-			}
-		}, InTimeOut);
-	}
-
-	bool Setup(TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, TUniqueFunction<void()>&& InCompleteFunc, float InTimeOut)
-	{
-		CompleteFunc_NoTimeOut_NoStopped = MoveTemp(InCompleteFunc);
-		return Setup(MoveTemp(InPredicate), MoveTemp(InTickFunc), [this](bool bTimeOut, bool bStopped)
-		{
-			if (CompleteFunc_NoTimeOut_NoStopped)
-			{
-				CompleteFunc_NoTimeOut_NoStopped();
-			}
-		}, InTimeOut);
-	}
-
 	bool Reset(bool bCallUpdate) override
 	{
 		if (bWithTimeOut)
@@ -100,6 +75,18 @@ protected:
 		return true;
 	}
 
+	bool ResetForPool() override
+	{
+		Predicate = nullptr;
+		TickFunc = nullptr;
+		CompleteFunc.Reset();
+		TimeOut = 0.f;
+		OriginTimeOut = 0.f;
+		bWithTimeOut = false;
+		bTimedOut = false;
+		return true;
+	}
+
 	void Tick(float DeltaTime) override 
 	{
 #if STATS
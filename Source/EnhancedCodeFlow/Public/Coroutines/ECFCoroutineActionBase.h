@@ -26,18 +26,31 @@ protected:
 
 	void BeginDestroy() override
 	{
-		// Handling a case when the owner has beed destroyed before the coroutine has been fully finished.
-		// In such case the handle must be explicitly destroyed.
+		DestroyAbandonedCoroutine();
+		Super::BeginDestroy();
+	}
+
+	bool ResetForPool() override
+	{
+		DestroyAbandonedCoroutine();
+		CoroutineHandle = FECFCoroutineHandle();
+		bHasCoroutineHandle = false;
+		return Super::ResetForPool();
+	}
+
+private:
+
+	// Handling a case when the owner has beed destroyed before the coroutine has been fully finished.
+	// In such case the handle must be explicitly destroyed.
+	void DestroyAbandonedCoroutine()
+	{
 		if (bHasCoroutineHandle && (HasValidOwner() == false) && (CoroutineHandle.promise().bHasFinished == false))
 		{
 			CoroutineHandle.promise().bHasFinished = true;
 			CoroutineHandle.destroy();
 		}
-		Super::BeginDestroy();
 	}
 
-private:
-
 	// Setting up action. The same as in ActionBase, but it additionally sets the coroutine handle.
 	void SetCoroutineAction(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFHandle& InHandleId, const FECFActionSettings& InSettings)
 	{
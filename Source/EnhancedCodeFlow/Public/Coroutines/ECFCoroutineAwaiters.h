@@ -5,6 +5,8 @@
 #include "ECFCoroutine.h"
 #include "ECFSubsystem.h"
 #include "ECFTypes.h"
+#include "ECFAsyncTask.h"
+#include "CodeFlowActions/Coroutines/ECFRunAsyncAndWait.h"
 
 class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter
 {
@@ -53,6 +55,14 @@ struct FECFCoroutineAwaiter_ResultWithTimeout
 	}
 };
 
+template<typename T>
+struct TECFCoroutineAwaiter_ResultWithValue
+{
+	TOptional<T> Result;
+	bool bStopped = false;
+	bool bTimedOut = false;
+};
+
 /*^^^ Wait Seconds Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_WaitSeconds : public FECFCoroutineAwaiter
@@ -132,7 +142,7 @@ class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_RunAsyncAndWait : public FECFCor
 public:
 
 	// C-tor
-	FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority);
+	FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, FECFAsyncTaskFunc&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFAsyncPipe& InPipe);
 
 	// Called when the suspension begins
 	void await_suspend(FECFCoroutineHandle InCoroHandle);
@@ -148,9 +158,58 @@ public:
 private:
 
 	// Storing values in order to use them when await_suspend is called
-	TUniqueFunction<void()> AsyncTaskFunction;
+	FECFAsyncTaskFunc AsyncTaskFunction;
+	float TimeOut = 0.f;
+	EECFAsyncPrio ThreadPriority = EECFAsyncPrio::Normal;
+	FECFAsyncPipe Pipe;
+};
+
+/*^^^ Run Async And Wait With Result Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+template<typename T>
+class TECFCoroutineAwaiter_RunAsyncAndWait : public FECFCoroutineAwaiter
+{
+public:
+
+	// C-tor
+	TECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TECFAsyncResultTask<T>&& InAsyncTask, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFAsyncPipe& InPipe)
+	{
+		Owner = InOwner;
+		Settings = InSettings;
+
+		AsyncTask = MoveTemp(InAsyncTask);
+		TimeOut = InTimeOut;
+		ThreadPriority = InThreadPriority;
+		Pipe = InPipe;
+	}
+
+	// Called when the suspension begins
+	void await_suspend(FECFCoroutineHandle InCoroHandle)
+	{
+		// The awaiter lives in the coroutine frame until the coroutine is resumed, so the result can be moved right into it.
+		AsyncTask.Callback = [this](TOptional<T>&& InResult, bool bTimedOut, bool bStopped)
+		{
+			Result = MoveTemp(InResult);
+		};
+		AddCoroutineAction<UECFRunAsyncAndWait>(Owner, InCoroHandle, Settings, MoveTemp(AsyncTask), TimeOut, ThreadPriority, Pipe);
+	}
+
+	// Returns the result of the task and the state of the corotuine after it's resumed.
+	TECFCoroutineAwaiter_ResultWithValue<T> await_resume()
+	{
+		return { MoveTemp(Result), CoroHandle.promise().bStopped, CoroHandle.promise().bTimedOut };
+	}
+
+private:
+
+	// Storing values in order to use them when await_suspend is called
+	TECFAsyncResultTask<T> AsyncTask;
 	float TimeOut = 0.f;
 	EECFAsyncPrio ThreadPriority = EECFAsyncPrio::Normal;
+	FECFAsyncPipe Pipe;
+
+	// Result of the task, moved here right before the coroutine is resumed.
+	TOptional<T> Result;
 };
 
 /*^^^ Wait Load Objects Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
@@ -7,9 +7,12 @@
 #include "ECFInstanceId.h"
 #include "ECFActionSettings.h"
 #include "ECFStats.h"
+#include "ECFTickContext.h"
+#include "ECFCompletionQueue.h"
 #include "Misc/AssertionMacros.h"
 #include "Engine/World.h"
 #include "GameFramework/WorldSettings.h"
+#include "UObject/ObjectKey.h"
 #include "ECFLogs.h"
 #include "ECFActionBase.generated.h"
 
@@ -21,6 +24,7 @@ class ENHANCEDCODEFLOW_API UECFActionBase : public UObject
 	GENERATED_BODY()
 
 	friend class UECFSubsystem;
+	friend struct FECFActionsBucket;
 
 public:
 
@@ -33,7 +37,7 @@ public:
 	// Checks if the action has valid owner
 	virtual bool HasValidOwner() const
 	{
-		return Owner.IsValid() && (Owner->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed) == false);
+		return (bOwnerTornDown == false) && Owner.IsValid() && (Owner->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed) == false);
 	}
 
 	// Checks if the action is valid
@@ -66,6 +70,15 @@ public:
 		return bIsPaused;
 	}
 
+	// Event-only actions are never ticked. They only react to being retriggered (or to other calls from the ECF API),
+	// so they are kept out of the tick loop until they are removed. Override it in actions that don't tick.
+	static constexpr bool bIsEventOnly = false;
+
+	// Actions which ticks only call plain code, without touching UObjects, can be ticked in parallel on worker threads
+	// when they are started with the bThreadSafeTick setting. Override it in such actions and finish them in ticks
+	// with FinishAndComplete, so their completions are deferred to the game thread.
+	static constexpr bool bSupportsThreadSafeTick = false;
+
 	// Checks if this action has this instance id.
 	bool HasInstanceId(const FECFInstanceId& InstanceIdToCheck) const
 	{
@@ -111,9 +124,52 @@ protected:
 		bHasFinished = true;
 	}
 
+	// Marks this action as finished and completes it. When the action is ticked in parallel,
+	// the completion is deferred and called on the game thread after all parallel ticks.
+	void FinishAndComplete()
+	{
+		MarkAsFinished();
+		if (bIsTickingInParallel)
+		{
+			bHasPendingComplete = true;
+		}
+		else
+		{
+			Complete(false);
+		}
+	}
+
+	// Returns the time for which this action doesn't have to be ticked, because it would only accumulate the time.
+	// The ECF system will not tick the action until this time passes and then it will tick it once with the whole
+	// time that has passed. Return 0 if this action must be ticked every frame.
+	virtual float GetSleepTime() const { return 0.f; }
+
+	// Returns the number of ticks for which this action doesn't have to be ticked, because it would only count them.
+	// The ECF system will not tick the action until these ticks pass and then it will call SkipTicks
+	// with the number of skipped ticks. Return 0 if this action must be ticked every frame.
+	virtual int32 GetSleepTicks() const { return 0; }
+
+	// Called when the action wakes up after sleeping for the given number of ticks.
+	virtual void SkipTicks(int32 TicksNum) {}
+
 	// Function called when this action is instanced and something tried to call it again.
 	virtual void RetriggeredInstancedAction() {}
 
+	// Function called when this action is removed from the ECF system for any reason: it has ended,
+	// it has been stopped, its owner has been destroyed or the whole system is shutting down.
+	// Release here everything that shouldn't outlive the action.
+	virtual void OnRemoved() {}
+
+	// Return true while the action waits for the work which notifies its end with the completion notifier.
+	// Such action is not ticked until the completion is notified, or until its sleep time passes (use it for timeouts).
+	virtual bool IsWaitingForCompletion() const { return false; }
+
+	// Returns the notifier which wakes up this action when it waits for the completion. It can be used on any thread.
+	FECFCompletionNotifier GetCompletionNotifier() const
+	{
+		return { CompletionQueue, HandleId };
+	}
+
 	// Function called when this action is resetted. Have in mind that not every action has
 	// reset functionality.
 	// If bCallUpdate is true - the action should run an update event (if there is any) 
@@ -130,6 +186,13 @@ protected:
 		MaxActionTime = InMaxActionTime;
 	}
 
+	// Returns the time of the time lane of this action at the current tick, without the time this action has been paused.
+	// Use it to measure the time of the action without accumulating delta times.
+	double GetActiveLaneTime() const
+	{
+		return TickLaneTime - PausedLaneTime;
+	}
+
 	// Pointer to the owner of this action. Owner must be valid all the time, otherwise
 	// the action will become invalid and will be deleted.
 	UPROPERTY(Transient)
@@ -183,10 +246,62 @@ protected:
 		return false;
 	}
 
+	// Function called when the finished action is returned to the pool, so it can be reused by the next action of the same class.
+	// Restore all members to their initial values and release all functions (and objects captured by them).
+	// Return true if the action can be reused. Actions which don't override it are not pooled.
+	virtual bool ResetForPool() { return false; }
+
 private:
 
+	// Restores this action to the state of a newly created one, so it can be kept in the pool.
+	// Returns false if the action doesn't support pooling.
+	bool PrepareForReuse()
+	{
+		if (ResetForPool() == false)
+		{
+			return false;
+		}
+
+		Owner.Reset();
+		HandleId.Invalidate();
+		InstanceId.Invalidate();
+		Settings = FECFActionSettings();
+
+		bHasFinished = false;
+		bFirstTick = false;
+		bIsPaused = false;
+		OwnerKey = FObjectKey();
+		bOwnerNotifiesTeardown = false;
+		bOwnerTornDown = false;
+		bIsEventAction = false;
+		IndexInBucket = INDEX_NONE;
+		ClockIndex = 0;
+
+		// SleepId is not restored, so outdated timer wheel entries can never match the reused action.
+		bIsSleeping = false;
+		bIsSleepingForTicks = false;
+		bIsWakingUp = false;
+		bIsDormant = false;
+		SleepLaneTime = 0.0;
+		SleepLaneFrame = 0;
+		bIsDeferred = false;
+		DeferredLaneTime = 0.0;
+		TickLaneTime = 0.0;
+		PausedLaneTime = 0.0;
+		bThreadSafeTick = false;
+		bIsTickingInParallel = false;
+		bHasPendingComplete = false;
+		bIsAwaitingCompletion = false;
+
+		CurrentActionTime = 0.f;
+		ActionDelayLeft = 0.f;
+		AccumulatedTime = 0.f;
+		MaxActionTime = 0.f;
+		return true;
+	}
+
 	// Performs a tick. Apply any settings to the time step.
-	void DoTick(float DeltaTime)
+	void DoTick(const FECFTickContext& TickContext)
 	{
 		// If this action is paused - ignore tick.
 		if (bIsPaused)
@@ -195,32 +310,19 @@ private:
 		}
 
 		// If game is paused and the action does not ignore this pause - ignore tick.
-		if (Settings.bIgnorePause == false)
+		if (TickContext.CanTick(Settings.bIgnorePause) == false)
 		{
-			if (UWorld* World = GetWorld())
-			{
-				if (World->IsPaused())
-				{
-					return;
-				}
-			}
+			return;
 		}
 
 		// If global time dilation is not ignored (by default it is not) apply
 		// this time dilation to the delta time.
-		if (Settings.bIgnoreGlobalTimeDilation == false)
-		{
-			float TimeDilation = 1.f;
-			if (UWorld* World = GetWorld())
-			{
-				if (AWorldSettings* WorldSettings = World->GetWorldSettings())
-				{
-					TimeDilation = WorldSettings->TimeDilation;
-				}
-			}
-			DeltaTime *= TimeDilation;
-		}
+		DoScaledTick(TickContext.GetDeltaTime(Settings.bIgnoreGlobalTimeDilation));
+	}
 
+	// Performs a tick with the delta time that has already been checked against pauses and time dilation.
+	void DoScaledTick(float DeltaTime)
+	{
 		// Delay first tick if specified in settings.
 		if (ActionDelayLeft > 0.f)
 		{
@@ -280,6 +382,65 @@ private:
 		}
 	}
 
+	// Returns the time for which this action can sleep, based on its settings and the action itself.
+	float GetAllowedSleepTime() const
+	{
+		// Paused actions stay awake, so they can be resumed at any time.
+		if (bIsPaused)
+		{
+			return 0.f;
+		}
+
+		// The first tick delay only accumulates time.
+		if (ActionDelayLeft > 0.f)
+		{
+			return ActionDelayLeft;
+		}
+
+		// The first tick must be launched as soon as possible.
+		if (bFirstTick)
+		{
+			return 0.f;
+		}
+
+		// With tick intervals the action is ticked only when the interval passes,
+		// otherwise ask the action itself.
+		float SleepTime = (Settings.TickInterval > 0.f) ? (Settings.TickInterval - AccumulatedTime) : GetSleepTime();
+
+		// Ensure the last tick will not be missed.
+		if (MaxActionTime > 0.f)
+		{
+			SleepTime = FMath::Min(SleepTime, MaxActionTime - CurrentActionTime);
+		}
+
+		return SleepTime;
+	}
+
+	// Returns the number of ticks for which this action can sleep, based on its settings and the action itself.
+	int32 GetAllowedSleepTicks() const
+	{
+		// Actions depending on the time are handled by GetAllowedSleepTime.
+		if (bIsPaused || bFirstTick || (ActionDelayLeft > 0.f) || (Settings.TickInterval > 0.f) || (MaxActionTime > 0.f))
+		{
+			return 0;
+		}
+
+		return GetSleepTicks();
+	}
+
+	// Skips the given number of ticks and the time that has passed during them.
+	void DoSkippedTicks(int32 TicksNum, float DeltaTime)
+	{
+		CurrentActionTime += DeltaTime;
+		SkipTicks(TicksNum);
+	}
+
+	// Returns the index of the time lane this action uses, based on which pauses and time dilation it ignores.
+	int32 GetTimeLaneIndex() const
+	{
+		return (Settings.bIgnorePause ? 1 : 0) | (Settings.bIgnoreGlobalTimeDilation ? 2 : 0);
+	}
+
 	// Indicates if this action has finished and will be deleted soon.
 	bool bHasFinished = false;
 
@@ -290,6 +451,73 @@ private:
 	// Indicates if this action is paused (by the ECF system).
 	bool bIsPaused = false;
 
+	// Key of the owner, used by the ECF system to find actions of the given owner.
+	FObjectKey OwnerKey;
+
+	// Indicates if the owner will notify the ECF system when it is torn down,
+	// so there is no need to check the owner every tick.
+	bool bOwnerNotifiesTeardown = false;
+
+	// Indicates if the owner has been torn down (set by the ECF system).
+	bool bOwnerTornDown = false;
+
+	// Indicates if this action has been declared as event-only and it is not ticked (set by the ECF system).
+	bool bIsEventAction = false;
+
+	// Index of this action in the bucket of its class.
+	int32 IndexInBucket = INDEX_NONE;
+
+	// Index of the clock used by this action (set by the ECF system).
+	uint8 ClockIndex = 0;
+
+	// Indicates if this action is sleeping in the timer wheel or the frame queue.
+	bool bIsSleeping = false;
+
+	// Indicates if this action is sleeping for the given number of ticks (in the frame queue).
+	bool bIsSleepingForTicks = false;
+
+	// Indicates if this action has been woken up and waits to be ticked again.
+	bool bIsWakingUp = false;
+
+	// Indicates if this action is paused and it is not ticked until it is resumed.
+	bool bIsDormant = false;
+
+	// Id of the current sleep, used to ignore outdated timer wheel entries.
+	uint32 SleepId = 0;
+
+	// Time of the time lane when this action fell asleep (or was last synchronized).
+	double SleepLaneTime = 0.0;
+
+	// Frame of the time lane when this action fell asleep (or was last synchronized).
+	uint64 SleepLaneFrame = 0;
+
+	// Indicates if this action hasn't been ticked because the tick budget of the subsystem has been spent.
+	bool bIsDeferred = false;
+
+	// Time of the time lane up to which this action has been ticked before it was deferred.
+	double DeferredLaneTime = 0.0;
+
+	// Time of the time lane up to which this action is being ticked (set by the ECF system).
+	double TickLaneTime = 0.0;
+
+	// Time of the time lane for which this action has been paused (set by the ECF system).
+	double PausedLaneTime = 0.0;
+
+	// Indicates if this action is ticked in parallel with other thread-safe actions (set by the ECF system).
+	bool bThreadSafeTick = false;
+
+	// Indicates if this action is being ticked on a worker thread.
+	bool bIsTickingInParallel = false;
+
+	// Indicates if this action has finished on a worker thread and waits to be completed on the game thread.
+	bool bHasPendingComplete = false;
+
+	// Indicates if this action is kept out of the tick loop until its awaited work is completed.
+	bool bIsAwaitingCompletion = false;
+
+	// Queue of completions of the subsystem which runs this action (set by the ECF system).
+	TWeakPtr<FECFCompletionQueue, ESPMode::ThreadSafe> CompletionQueue;
+
 	// Timers for this action
 	float CurrentActionTime = 0.f;
 	float ActionDelayLeft = 0.f;
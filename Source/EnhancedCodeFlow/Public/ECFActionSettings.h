@@ -5,6 +5,34 @@
 #include "CoreMinimal.h"
 #include "ECFActionSettings.generated.h"
 
+// Point of the frame in which actions are ticked.
+UENUM(BlueprintType)
+enum class EECFTickGroup : uint8
+{
+	// Ticked by the subsystem, after all tick groups of the world.
+	Default,
+	// Ticked with the engine's PrePhysics tick group, before the physics simulation starts.
+	PrePhysics,
+	// Ticked with the engine's DuringPhysics tick group, while the physics simulation runs.
+	DuringPhysics,
+	// Ticked with the engine's PostPhysics tick group, after the physics simulation ends.
+	PostPhysics,
+	// Ticked with the engine's PostUpdateWork tick group, at the end of the frame.
+	PostUpdateWork,
+};
+
+// Priority of ticking actions when the tick budget of the subsystem is limited.
+UENUM(BlueprintType)
+enum class EECFPriority : uint8
+{
+	// Always ticked, no matter how much of the budget has been spent.
+	Critical,
+	// Ticked while there is budget left. Deferred to the next frames otherwise.
+	Normal,
+	// Ticked after normal actions while there is budget left. Deferred to the next frames otherwise.
+	Background,
+};
+
 USTRUCT(BlueprintType)
 struct ENHANCEDCODEFLOW_API FECFActionSettings
 {
@@ -16,18 +44,26 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 		bIgnorePause(false),
 		bIgnoreGlobalTimeDilation(false),
 		bStartPaused(false),
-		Label(TEXT(""))
+		Label(TEXT("")),
+		Clock(NAME_None),
+		TickGroup(EECFTickGroup::Default),
+		Priority(EECFPriority::Normal),
+		bThreadSafeTick(false)
 	{
 
 	}
 
-	FECFActionSettings(float InTickInterval, float InFirstDelay = 0.f, bool InIgnorePause = false, bool InIgnoreTimeDilation = false, bool InStartPaused = false, const FString& InLabel = TEXT("")) :
+	FECFActionSettings(float InTickInterval, float InFirstDelay = 0.f, bool InIgnorePause = false, bool InIgnoreTimeDilation = false, bool InStartPaused = false, const FString& InLabel = TEXT(""), FName InClock = NAME_None, EECFTickGroup InTickGroup = EECFTickGroup::Default, EECFPriority InPriority = EECFPriority::Normal, bool InThreadSafeTick = false) :
 		TickInterval(InTickInterval),
 		FirstDelay(InFirstDelay),
 		bIgnorePause(InIgnorePause),
 		bIgnoreGlobalTimeDilation(InIgnoreTimeDilation),
 		bStartPaused(InStartPaused),
-		Label(InLabel)
+		Label(InLabel),
+		Clock(InClock),
+		TickGroup(InTickGroup),
+		Priority(InPriority),
+		bThreadSafeTick(InThreadSafeTick)
 	{
 	}
 
@@ -48,6 +84,23 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 
 	UPROPERTY(BlueprintReadWrite, Category = "ECF")
 	FString Label;
+
+	// Name of the clock used by the action (see FECFClocks). None means the Gameplay clock.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	FName Clock;
+
+	// Tick group of the engine in which the action is ticked.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	EECFTickGroup TickGroup = EECFTickGroup::Default;
+
+	// Priority of the action when the tick budget of the subsystem is limited.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	EECFPriority Priority = EECFPriority::Normal;
+
+	// Indicates if the tick function of the action is thread-safe, so the action can be ticked in parallel
+	// with other such actions. Only actions supporting it (Ticker and Timelines) use it. Callbacks are always
+	// called on the game thread. Not exposed to Blueprints, as Blueprint functions can't run on worker threads.
+	bool bThreadSafeTick = false;
 };
 
 #define ECF_TICKINTERVAL(_Interval) FECFActionSettings(_Interval, 0.f, false, false, false, TEXT(""))
@@ -57,3 +110,7 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 #define ECF_IGNOREPAUSEDILATION FECFActionSettings(0.f, 0.f, true, true, false, TEXT(""))
 #define ECF_STARTPAUSED FECFActionSettings(0.f, 0.f, false, false, true, TEXT(""))
 #define ECF_LABEL(_Label) FECFActionSettings(0.f, 0.f, false, false, false, _Label)
+#define ECF_CLOCK(_Clock) FECFActionSettings(0.f, 0.f, false, false, false, TEXT(""), _Clock)
+#define ECF_TICKGROUP(_TickGroup) FECFActionSettings(0.f, 0.f, false, false, false, TEXT(""), NAME_None, _TickGroup)
+#define ECF_PRIORITY(_Priority) FECFActionSettings(0.f, 0.f, false, false, false, TEXT(""), NAME_None, EECFTickGroup::Default, _Priority)
+#define ECF_THREADSAFETICK FECFActionSettings(0.f, 0.f, false, false, false, TEXT(""), NAME_None, EECFTickGroup::Default, EECFPriority::Normal, true)
@@ -17,6 +17,9 @@
 #include "CodeFlowActions/ECFDoOnce.h"
 #include "CodeFlowActions/ECFDoNTimes.h"
 #include "CodeFlowActions/ECFDoNoMoreThanXTime.h"
+#include "CodeFlowActions/ECFGate.h"
+#include "CodeFlowActions/ECFFlipFlop.h"
+#include "CodeFlowActions/ECFLatch.h"
 #include "CodeFlowActions/ECFRunAsyncThen.h"
 #include "CodeFlowActions/ECFLoadObjectsAsync.h"
 
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFAsyncTask.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Graph of async stages run by one RunAsyncPipeline action.
+ * Every stage is launched on a worker thread as soon as its prerequisites end, without going back to the Game Thread,
+ * so only the callback of the whole pipeline waits for the ECF tick.
+ * Stages can be added only after their prerequisites, so the graph never has cycles.
+ * Stages don't pass results to each other - share the data with the captured shared pointers.
+ */
+class ENHANCEDCODEFLOW_API FECFAsyncPipeline
+{
+
+	friend class FECFAsyncTask;
+
+public:
+
+	/**
+	 * Stage functions can be: [](const FECFCancellationToken& CancellationToken) -> void.
+	 * Stage functions can be: []() -> void.
+	 * Every function returns the id of the added stage, or INDEX_NONE if the stage is invalid.
+	 */
+
+	// Adds the stage without prerequisites, which is launched at the start of the pipeline.
+	int32 Add(TUniqueFunction<void(const FECFCancellationToken&)>&& InFunc) { return AddStage({}, false, MoveTemp(InFunc)); }
+	int32 Add(TUniqueFunction<void()>&& InFunc) { return AddStage({}, false, MoveTemp(InFunc)); }
+
+	// Adds the stage launched after the given stage ends.
+	int32 Then(int32 Prerequisite, TUniqueFunction<void(const FECFCancellationToken&)>&& InFunc) { return AddStage({ Prerequisite }, false, MoveTemp(InFunc)); }
+	int32 Then(int32 Prerequisite, TUniqueFunction<void()>&& InFunc) { return AddStage({ Prerequisite }, false, MoveTemp(InFunc)); }
+
+	// Adds the stage launched after all of the given stages end.
+	int32 WhenAll(const TArray<int32>& Prerequisites, TUniqueFunction<void(const FECFCancellationToken&)>&& InFunc) { return AddStage(Prerequisites, false, MoveTemp(InFunc)); }
+	int32 WhenAll(const TArray<int32>& Prerequisites, TUniqueFunction<void()>&& InFunc) { return AddStage(Prerequisites, false, MoveTemp(InFunc)); }
+
+	// Adds the stage launched after any of the given stages ends. The pipeline still ends only when all stages end.
+	int32 WhenAny(const TArray<int32>& Prerequisites, TUniqueFunction<void(const FECFCancellationToken&)>&& InFunc) { return AddStage(Prerequisites, true, MoveTemp(InFunc)); }
+	int32 WhenAny(const TArray<int32>& Prerequisites, TUniqueFunction<void()>&& InFunc) { return AddStage(Prerequisites, true, MoveTemp(InFunc)); }
+
+	// Checks if the pipeline has stages and all of them have been added properly.
+	bool IsValid() const;
+
+	// Returns the number of stages.
+	int32 Num() const;
+
+private:
+
+	struct FStage
+	{
+		FECFAsyncTaskFunc Func;
+
+		// Stages launched after this one.
+		TArray<int32> Dependents;
+
+		// Number of stages that must end before this one is launched. WhenAny stages wait only for one.
+		int32 PrerequisitesNum = 0;
+	};
+
+	int32 AddStage(const TArray<int32>& Prerequisites, bool bWhenAny, FECFAsyncTaskFunc&& InFunc);
+
+	TArray<FStage> Stages;
+	bool bHasInvalidStages = false;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,306 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+#include "Misc/Optional.h"
+#include "UObject/ObjectKey.h"
+#include "ECFCallback.h"
+#include "ECFTypes.h"
+#include "ECFCompletionQueue.h"
+#include <atomic>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class FECFAsyncPipeline;
+
+/**
+ * Token passed to async task functions, so they can check if their result is still needed.
+ * It is canceled when the action running the task times out, is stopped, or when its owner is destroyed.
+ * Long tasks should check it from time to time and return early when it is canceled.
+ * It can be copied and checked on any thread.
+ */
+class ENHANCEDCODEFLOW_API FECFCancellationToken
+{
+
+public:
+
+	FECFCancellationToken() :
+		bIsCanceled(MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false))
+	{}
+
+	// Checks if the task should be canceled.
+	bool IsCanceled() const
+	{
+		return bIsCanceled->load(std::memory_order_relaxed);
+	}
+
+	// Cancels the task. Every copy of this token will be canceled.
+	void Cancel() const
+	{
+		bIsCanceled->store(true, std::memory_order_relaxed);
+	}
+
+private:
+
+	TSharedRef<std::atomic<bool>, ESPMode::ThreadSafe> bIsCanceled;
+};
+
+/**
+ * Pipe in which async tasks run. Tasks in the same pipe run one after another, in the order they have been launched,
+ * while tasks in different pipes run in parallel, so the work that must not overlap doesn't need any locks.
+ * Use the name for a pipe shared by everyone, e.g. TEXT("Saves"), or a numbered name for a user key, e.g. FName(TEXT("Saves"), PlayerId).
+ * Use PerOwner for a separate pipe for every owner of the action.
+ */
+struct ENHANCEDCODEFLOW_API FECFAsyncPipe
+{
+	FECFAsyncPipe() = default;
+	FECFAsyncPipe(FName InName) : Name(InName) {}
+	FECFAsyncPipe(const TCHAR* InName) : Name(InName) {}
+
+	// Pipe of the given name, separate for every owner of the action.
+	static FECFAsyncPipe PerOwner(FName InName = NAME_None)
+	{
+		FECFAsyncPipe NewPipe(InName);
+		NewPipe.bPerOwner = true;
+		return NewPipe;
+	}
+
+	// Returns the pipe for the given owner of the action. Pipes which are not per owner are returned as they are.
+	FECFAsyncPipe ForOwner(const UObject* InOwner) const
+	{
+		FECFAsyncPipe OwnerPipe = *this;
+		if (bPerOwner)
+		{
+			OwnerPipe.OwnerKey = FObjectKey(InOwner);
+		}
+		return OwnerPipe;
+	}
+
+	// Checks if the task should run outside of any pipe.
+	bool IsNone() const
+	{
+		return Name.IsNone() && (bPerOwner == false);
+	}
+
+	FString ToString() const
+	{
+		return bPerOwner ? FString::Printf(TEXT("%s (Per Owner)"), *Name.ToString()) : Name.ToString();
+	}
+
+	bool operator==(const FECFAsyncPipe& Other) const
+	{
+		return (Name == Other.Name) && (OwnerKey == Other.OwnerKey) && (bPerOwner == Other.bPerOwner);
+	}
+
+	friend uint32 GetTypeHash(const FECFAsyncPipe& Pipe)
+	{
+		return HashCombine(GetTypeHash(Pipe.Name), GetTypeHash(Pipe.OwnerKey));
+	}
+
+	FName Name;
+	FObjectKey OwnerKey;
+	bool bPerOwner = false;
+};
+
+// Function running on a separate thread. Can take the cancellation token or nothing.
+using FECFAsyncTaskFunc = TECFCallback<void(const FECFCancellationToken&), void()>;
+
+/**
+ * Function running on a separate thread and returning a result, together with the callback receiving the result
+ * on the Game Thread. The result is unset if the function hasn't ended, e.g. because of the timeout.
+ * The result is moved from the function into the task and then into the callback, so it is never copied
+ * and it doesn't need any extra allocation.
+ */
+template<typename T>
+struct TECFAsyncResultTask
+{
+	// Only one of the functions should be set.
+	TUniqueFunction<T(const FECFCancellationToken&)> FuncWithToken;
+	TUniqueFunction<T()> Func;
+	TUniqueFunction<void(TOptional<T>&&, bool/* bTimedOut*/, bool/* bStopped*/)> Callback;
+
+	bool IsSet() const
+	{
+		return (FuncWithToken || Func) && Callback;
+	}
+};
+
+// Statistics of the executor running ECF async tasks.
+struct FECFAsyncExecutorStats
+{
+	// Number of tasks waiting in the queue for a free slot.
+	int32 QueuedTasksNum = 0;
+
+	// Number of tasks launched on worker threads which haven't ended yet.
+	int32 TasksInFlightNum = 0;
+
+	// Average time (in seconds) tasks wait in the queue before they are launched.
+	double AverageWaitTime = 0.0;
+
+	// Average time (in seconds) tasks run on worker threads.
+	double AverageRunTime = 0.0;
+};
+
+/**
+ * Async task launched by ECF actions. It runs the given function on a worker thread
+ * with the given priority, or in a named pipe, so tasks in the same pipe never run concurrently.
+ * The function and the state of the task are shared with the worker thread, so the task
+ * doesn't touch the action that launched it.
+ * All tasks are launched by the ECF executor. When the number of tasks running at once is limited,
+ * the tasks above the limit wait in the queue of their priority, so they don't flood the worker threads.
+ */
+class ENHANCEDCODEFLOW_API FECFAsyncTask
+{
+
+public:
+
+	// Launches the given function. When it ends, the given notifier is notified. Returns false if the function is not set.
+	bool Launch(FECFAsyncTaskFunc&& InFunc, EECFAsyncPrio InPriority, const FECFAsyncPipe& InPipe = {}, const FECFCompletionNotifier& InCompletionNotifier = {});
+
+	// Launches the given function returning a result. The result is passed to the callback of the task by Complete.
+	template<typename T>
+	bool Launch(TECFAsyncResultTask<T>&& InTask, EECFAsyncPrio InPriority, const FECFAsyncPipe& InPipe = {}, const FECFCompletionNotifier& InCompletionNotifier = {})
+	{
+		Reset();
+
+		if (InTask.IsSet() == false)
+		{
+			return false;
+		}
+
+		TSharedRef<TResultState<T>, ESPMode::ThreadSafe> NewState = MakeShared<TResultState<T>, ESPMode::ThreadSafe>();
+		NewState->Task = MoveTemp(InTask);
+		LaunchState(NewState, InPriority, InPipe, InCompletionNotifier);
+		return true;
+	}
+
+	// Launches the stages of the given pipeline. The task is done when all stages end. Returns false if the pipeline is not valid.
+	bool Launch(FECFAsyncPipeline&& InPipeline, EECFAsyncPrio InPriority, const FECFCompletionNotifier& InCompletionNotifier = {});
+
+	// Signals the cancellation to the running function. The function is not called at all if it hasn't been started yet.
+	void Cancel();
+
+	// Cancels the function and releases the task. Game Thread only.
+	void Reset();
+
+	// Checks if the launched function has ended.
+	bool IsDone() const;
+
+	// Checks if the launched function has left the queue of the executor. The completion notifier is notified when it happens.
+	bool IsStarted() const;
+
+	// Calls the callback of the task returning a result, if there is any. Game Thread only.
+	void Complete(bool bTimedOut, bool bStopped);
+
+	// Sets the maximum number of tasks running on worker threads at once. 0 means no limit. Game Thread only.
+	static void SetMaxTasksInFlight(int32 InMaxTasksInFlight);
+
+	// Returns the current statistics of the executor.
+	static FECFAsyncExecutorStats GetExecutorStats();
+
+private:
+
+	struct FState
+	{
+		virtual ~FState() = default;
+
+		// Calls the callback of the task, if there is any. Game Thread only.
+		virtual void Complete(bool bTimedOut, bool bStopped) {}
+
+		// Releases the callback of the task, so it isn't released on a worker thread. Game Thread only.
+		virtual void ReleaseCallback() {}
+
+		FECFCancellationToken CancellationToken;
+		FECFCompletionNotifier CompletionNotifier;
+		std::atomic<bool> bIsDone { false };
+		std::atomic<bool> bIsStarted { false };
+
+		// Marks the task as done and notifies about it. Worker thread only.
+		void Finish()
+		{
+			bIsDone.store(true, std::memory_order_release);
+			CompletionNotifier.Notify();
+		}
+	};
+
+	// State of the task running a single function.
+	struct FSingleState : public FState
+	{
+		// Calls the function. Worker thread only.
+		virtual void Execute() = 0;
+	};
+
+	struct FFuncState : public FSingleState
+	{
+		void Execute() override
+		{
+			Func(CancellationToken);
+		}
+
+		FECFAsyncTaskFunc Func;
+	};
+
+	template<typename T>
+	struct TResultState : public FSingleState
+	{
+		void Execute() override
+		{
+			if (Task.FuncWithToken)
+			{
+				Result.Emplace(Task.FuncWithToken(CancellationToken));
+			}
+			else
+			{
+				Result.Emplace(Task.Func());
+			}
+		}
+
+		void Complete(bool bTimedOut, bool bStopped) override
+		{
+			if (Task.Callback)
+			{
+				// The result is written on the worker thread, so it can be taken only after the function has ended.
+				if (bIsDone.load(std::memory_order_acquire))
+				{
+					Task.Callback(MoveTemp(Result), bTimedOut, bStopped);
+				}
+				else
+				{
+					Task.Callback(TOptional<T>(), bTimedOut, bStopped);
+				}
+			}
+		}
+
+		void ReleaseCallback() override
+		{
+			Task.Callback.Reset();
+		}
+
+		TECFAsyncResultTask<T> Task;
+		TOptional<T> Result;
+	};
+
+	// State of the task running the pipeline. Defined in the cpp, because only the task uses it.
+	struct FPipelineState;
+
+	// Executor launching tasks on worker threads. Defined in the cpp, because only the task uses it.
+	class FExecutor;
+
+	// Launches the given state of the task.
+	void LaunchState(const TSharedRef<FSingleState, ESPMode::ThreadSafe>& NewState, EECFAsyncPrio InPriority, const FECFAsyncPipe& InPipe, const FECFCompletionNotifier& InCompletionNotifier);
+
+	// Runs the function of the given task on the current thread.
+	static void Run(const TSharedRef<FSingleState, ESPMode::ThreadSafe>& InState);
+
+	// Launches the given stage of the pipeline on a worker thread.
+	static void LaunchStage(const TSharedRef<FPipelineState, ESPMode::ThreadSafe>& InState, int32 StageId);
+
+	// Runs the given stage of the pipeline on the current thread and launches the stages waiting for it.
+	static void RunStage(const TSharedRef<FPipelineState, ESPMode::ThreadSafe>& InState, int32 StageId);
+
+	TSharedPtr<FState, ESPMode::ThreadSafe> State;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
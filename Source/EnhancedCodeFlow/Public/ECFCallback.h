@@ -0,0 +1,258 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Tuple.h"
+#include "Templates/IntegerSequence.h"
+#include <type_traits>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+// Size of the buffer in which callbacks keep their functions without allocating them. Bigger functions are allocated.
+#ifndef ECF_CALLBACK_INLINE_SIZE
+#define ECF_CALLBACK_INLINE_SIZE 32
+#endif
+
+namespace ECFCallback
+{
+	template<typename FuncType, typename RetType, typename Signature>
+	struct TSignatureArity
+	{
+		static constexpr int32 Value = INDEX_NONE;
+	};
+
+	template<typename FuncType, typename RetType, typename SigRetType, typename... SigParamTypes>
+	struct TSignatureArity<FuncType, RetType, SigRetType(SigParamTypes...)>
+	{
+		static constexpr int32 Value = std::is_invocable_r_v<RetType, FuncType&, SigParamTypes...> ? static_cast<int32>(sizeof...(SigParamTypes)) : INDEX_NONE;
+	};
+
+	// Returns the number of parameters of the first given signature the function can be called with, or INDEX_NONE.
+	template<typename FuncType, typename RetType, typename... Signatures>
+	constexpr int32 GetCallArity()
+	{
+		int32 Result = INDEX_NONE;
+		((Result = (Result == INDEX_NONE) ? TSignatureArity<FuncType, RetType, Signatures>::Value : Result), ...);
+		return Result;
+	}
+}
+
+/**
+ * Single slot for a callback that can be given with one of a few signatures.
+ * The first signature is the full one, the next ones must take the leading parameters of it, e.g.
+ * TECFCallback<void(bool, bool), void(bool), void()>.
+ * The given function is stored as it is and called with as many parameters as it takes, so actions
+ * don't have to keep a function per signature and wrap shorter ones in lambdas calling them.
+ * Functions up to ECF_CALLBACK_INLINE_SIZE bytes are kept inside the callback, so lambdas given directly don't allocate.
+ */
+template<typename FullSignature, typename... ReducedSignatures>
+class TECFCallback;
+
+template<typename RetType, typename... ParamTypes, typename... ReducedSignatures>
+class TECFCallback<RetType(ParamTypes...), ReducedSignatures...>
+{
+
+	template<typename FuncType>
+	static constexpr int32 CallArity = ECFCallback::GetCallArity<FuncType, RetType, RetType(ParamTypes...), ReducedSignatures...>();
+
+public:
+
+	TECFCallback() = default;
+	TECFCallback(TYPE_OF_NULLPTR) {}
+
+	template<typename Signature>
+	TECFCallback(TUniqueFunction<Signature>&& InFunc)
+	{
+		Set(MoveTemp(InFunc));
+	}
+
+	template<typename FuncType, typename = std::enable_if_t<(CallArity<std::decay_t<FuncType>> != INDEX_NONE) && (std::is_same_v<std::decay_t<FuncType>, TECFCallback> == false)>>
+	TECFCallback(FuncType&& InFunc)
+	{
+		Set(Forward<FuncType>(InFunc));
+	}
+
+	TECFCallback(TECFCallback&& Other)
+	{
+		MoveFrom(Other);
+	}
+
+	TECFCallback& operator=(TECFCallback&& Other)
+	{
+		if (this != &Other)
+		{
+			Reset();
+			MoveFrom(Other);
+		}
+		return *this;
+	}
+
+	TECFCallback(const TECFCallback&) = delete;
+	TECFCallback& operator=(const TECFCallback&) = delete;
+
+	~TECFCallback()
+	{
+		Reset();
+	}
+
+	// Stores the given function. Unset functions leave the callback unset.
+	template<typename Signature>
+	void Set(TUniqueFunction<Signature>&& InFunc)
+	{
+		if (InFunc)
+		{
+			Emplace(MoveTemp(InFunc));
+		}
+		else
+		{
+			Reset();
+		}
+	}
+
+	// Stores the given function, e.g. a lambda, inside the callback if it fits, otherwise allocates it.
+	template<typename FuncType, typename = std::enable_if_t<CallArity<std::decay_t<FuncType>> != INDEX_NONE>>
+	void Set(FuncType&& InFunc)
+	{
+		Emplace(Forward<FuncType>(InFunc));
+	}
+
+	// Releases the stored function.
+	void Reset()
+	{
+		if (Ops)
+		{
+			Ops->Destroy(Buffer);
+			Ops = nullptr;
+		}
+	}
+
+	bool IsSet() const
+	{
+		return Ops != nullptr;
+	}
+
+	explicit operator bool() const
+	{
+		return IsSet();
+	}
+
+	// Indicates if the stored function is kept inside the callback, without an allocation.
+	bool IsInline() const
+	{
+		return Ops && Ops->bIsInline;
+	}
+
+	RetType operator()(ParamTypes... Params) const
+	{
+		checkf(IsSet(), TEXT("Calling unset ECF callback!"));
+		return Ops->Call(Buffer, Params...);
+	}
+
+private:
+
+	struct FOps
+	{
+		RetType (*Call)(void* Storage, ParamTypes&... Params);
+
+		// Moves the function to the other storage and destroys it in this one.
+		void (*Move)(void* Destination, void* Source);
+
+		void (*Destroy)(void* Storage);
+
+		bool bIsInline;
+	};
+
+	template<typename FuncType>
+	struct TIsInline
+	{
+		static constexpr bool Value = (sizeof(FuncType) <= ECF_CALLBACK_INLINE_SIZE) && (alignof(FuncType) <= alignof(void*)) && std::is_nothrow_move_constructible_v<FuncType>;
+	};
+
+	template<typename FuncType>
+	struct TInlineOps
+	{
+		static RetType Call(void* Storage, ParamTypes&... Params)
+		{
+			return CallWithLeadingParams(*reinterpret_cast<FuncType*>(Storage), TMakeIntegerSequence<uint32, CallArity<FuncType>>(), Params...);
+		}
+
+		static void Move(void* Destination, void* Source)
+		{
+			FuncType* SourceFunc = reinterpret_cast<FuncType*>(Source);
+			new (Destination) FuncType(MoveTemp(*SourceFunc));
+			SourceFunc->~FuncType();
+		}
+
+		static void Destroy(void* Storage)
+		{
+			reinterpret_cast<FuncType*>(Storage)->~FuncType();
+		}
+
+		static constexpr FOps Ops = { &Call, &Move, &Destroy, true };
+	};
+
+	template<typename FuncType>
+	struct THeapOps
+	{
+		static RetType Call(void* Storage, ParamTypes&... Params)
+		{
+			return CallWithLeadingParams(**reinterpret_cast<FuncType**>(Storage), TMakeIntegerSequence<uint32, CallArity<FuncType>>(), Params...);
+		}
+
+		static void Move(void* Destination, void* Source)
+		{
+			*reinterpret_cast<FuncType**>(Destination) = *reinterpret_cast<FuncType**>(Source);
+		}
+
+		static void Destroy(void* Storage)
+		{
+			delete *reinterpret_cast<FuncType**>(Storage);
+		}
+
+		static constexpr FOps Ops = { &Call, &Move, &Destroy, false };
+	};
+
+	template<typename FuncType, uint32... Indices>
+	static RetType CallWithLeadingParams(FuncType& Func, TIntegerSequence<uint32, Indices...>, ParamTypes&... Params)
+	{
+		TTuple<ParamTypes&...> ParamsTuple(Params...);
+		return Func(ParamsTuple.template Get<Indices>()...);
+	}
+
+	template<typename FuncType>
+	void Emplace(FuncType&& InFunc)
+	{
+		using FStoredFunc = std::decay_t<FuncType>;
+		Reset();
+		if constexpr (TIsInline<FStoredFunc>::Value)
+		{
+			new (Buffer) FStoredFunc(Forward<FuncType>(InFunc));
+			Ops = &TInlineOps<FStoredFunc>::Ops;
+		}
+		else
+		{
+			*reinterpret_cast<FStoredFunc**>(Buffer) = new FStoredFunc(Forward<FuncType>(InFunc));
+			Ops = &THeapOps<FStoredFunc>::Ops;
+		}
+	}
+
+	void MoveFrom(TECFCallback& Other)
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Move(Buffer, Other.Buffer);
+			Ops = Other.Ops;
+			Other.Ops = nullptr;
+		}
+	}
+
+	// Functions of the stored function, or null if the callback is not set.
+	const FOps* Ops = nullptr;
+
+	// The stored function, or the pointer to it if it doesn't fit. Mutable, because the callback can be called
+	// when it is const, as TUniqueFunction can.
+	alignas(void*) mutable uint8 Buffer[ECF_CALLBACK_INLINE_SIZE];
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,29 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Names of clocks created by the ECF system. Every clock can be paused and have its time scaled,
+ * which affects all actions using it. Actions use the Gameplay clock, unless specified otherwise in their settings.
+ * Any other name can be used too - such clock will be created when it is needed for the first time.
+ */
+struct ENHANCEDCODEFLOW_API FECFClocks
+{
+	// Default clock, affected by the game pause and the global time dilation.
+	static const FName Gameplay;
+
+	// Clock for the user interface, not affected by the game pause nor the global time dilation.
+	static const FName UI;
+
+	// Clock for cinematics, affected by the game pause and the global time dilation.
+	static const FName Cinematic;
+
+	// Clock of the real time, not affected by the game pause nor the global time dilation.
+	static const FName Real;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
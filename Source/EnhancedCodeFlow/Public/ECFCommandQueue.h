@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "ECFHandle.h"
+#include <atomic>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Queue of commands for the ECF subsystem, which can be submitted from any thread without locks.
+ * Commands are executed by the subsystem on the Game Thread at the beginning of its next tick,
+ * in the order they have been submitted.
+ * Starting an action immediately returns a handle reserved by the subsystem up front, so the action
+ * can be controlled with the next commands (or checked with FECFHandleGenerations) before it is actually started.
+ * The queue must be obtained on the Game Thread (FFlow::GetCommandQueue), but it can be used on any thread.
+ */
+class ENHANCEDCODEFLOW_API FECFCommandQueue
+{
+
+	friend class UECFSubsystem;
+
+public:
+
+	FECFCommandQueue();
+
+	FECFCommandQueue(const FECFCommandQueue&) = delete;
+	FECFCommandQueue& operator=(const FECFCommandQueue&) = delete;
+
+	// Queues the function starting an action with the regular ECF API, e.g. FFlow::Delay. The function is called
+	// on the Game Thread and the first action started by it gets the returned handle.
+	// Returns invalid handle if the subsystem doesn't exist anymore, or if it has no reserved handles left.
+	// In the latter case the action is started anyway, but it can't be controlled from this thread.
+	FECFHandle StartAction(TUniqueFunction<void()>&& StartFunc);
+
+	// Queues stopping the action pointed by the given handle.
+	void StopAction(const FECFHandle& Handle, bool bComplete = false);
+
+	// Queues pausing the action pointed by the given handle.
+	void PauseAction(const FECFHandle& Handle);
+
+	// Queues resuming the action pointed by the given handle.
+	void ResumeAction(const FECFHandle& Handle);
+
+	// Maximum number of handles reserved for actions started from other threads during one frame.
+	static constexpr uint32 MaxReservedHandles = 256;
+
+private:
+
+	enum class ECommandType : uint8
+	{
+		StartAction,
+		StopAction,
+		PauseAction,
+		ResumeAction
+	};
+
+	struct FCommand
+	{
+		ECommandType Type = ECommandType::StartAction;
+		FECFHandle Handle;
+		bool bComplete = false;
+		TUniqueFunction<void()> StartFunc;
+	};
+
+	// Adds the command to the queue, unless the queue has been closed.
+	void Enqueue(FCommand&& Command);
+
+	// Takes the next command. Game Thread only.
+	bool Dequeue(FCommand& OutCommand);
+
+	// Checks if there are no commands. Game Thread only.
+	bool IsEmpty() const;
+
+	// Takes one of the reserved handles. Can be called from any thread.
+	bool TakeReservedHandle(FECFHandle& OutHandle);
+
+	// Adds the reserved handle. Returns false if there is no place for it. Game Thread only.
+	bool AddReservedHandle(const FECFHandle& Handle);
+
+	// Returns the number of reserved handles that haven't been taken yet.
+	uint32 GetReservedHandlesNum() const;
+
+	// Stops accepting new commands. Called when the subsystem is destroyed.
+	void Close();
+
+	// Commands submitted by any thread and executed by the Game Thread.
+	TQueue<FCommand, EQueueMode::Mpsc> Commands;
+
+	// Ring of reserved handles. Only the Game Thread adds handles, while any thread can take them.
+	std::atomic<uint64> ReservedHandles[MaxReservedHandles];
+	std::atomic<uint64> ReservedReadIndex;
+	std::atomic<uint64> ReservedWriteIndex;
+
+	// Indicates if the queue doesn't accept new commands.
+	std::atomic<bool> bIsClosed;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Templates/SharedPointer.h"
+#include "ECFHandle.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Queue of completions of the work awaited by actions, like async tasks or async loading.
+ * Completions can be pushed from any thread without locks. The subsystem drains the queue on the Game Thread
+ * at the beginning of its tick and wakes up the actions waiting for them, so these actions are not ticked while they wait.
+ */
+class ENHANCEDCODEFLOW_API FECFCompletionQueue
+{
+
+	friend class UECFSubsystem;
+
+public:
+
+	// Pushes the completion of the work awaited by the action with the given handle. Can be called from any thread.
+	void Push(const FECFHandle& Handle);
+
+private:
+
+	struct FCompletion
+	{
+		FECFHandle Handle;
+
+		// Time when the completion has been pushed, used to measure the time it waits for the Game Thread.
+		double PushTime = 0.0;
+	};
+
+	// Takes the next completion. Game Thread only.
+	bool Pop(FCompletion& OutCompletion);
+
+	// Checks if there are no completions. Game Thread only.
+	bool IsEmpty() const;
+
+	TQueue<FCompletion, EQueueMode::Mpsc> Completions;
+};
+
+/**
+ * Pushes the completion of the work awaited by one action. It can be copied to and used on any thread.
+ * It does nothing when the subsystem doesn't exist anymore.
+ */
+struct ENHANCEDCODEFLOW_API FECFCompletionNotifier
+{
+	TWeakPtr<FECFCompletionQueue, ESPMode::ThreadSafe> Queue;
+	FECFHandle Handle;
+
+	void Notify() const
+	{
+		if (TSharedPtr<FECFCompletionQueue, ESPMode::ThreadSafe> PinnedQueue = Queue.Pin())
+		{
+			PinnedQueue->Push(Handle);
+		}
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,48 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFTimerWheel.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Queue used by the ECF subsystem to keep actions sleeping for the given number of frames.
+ * Entries are kept in a heap ordered by the frame they are due in, so only entries
+ * that are due are touched when the queue advances.
+ */
+class ENHANCEDCODEFLOW_API FECFFrameQueue
+{
+
+public:
+
+	// Entries are the same as in the timer wheel, but they are due in frames instead of ticks of the wheel.
+	using FEntry = FECFTimerWheel::FEntry;
+
+	// Schedules the entry to be released when the queue reaches the given frame.
+	void Schedule(const FECFHandle& Handle, uint32 SleepId, uint64 DueFrame);
+
+	// Moves the queue to the given frame and appends all entries that are due to the given array.
+	void Advance(uint64 NewFrame, TArray<FEntry>& OutDueEntries);
+
+	// Removes all entries.
+	void Reset();
+
+	// Returns the number of scheduled entries.
+	int32 Num() const { return Entries.Num(); }
+
+private:
+
+	struct FDueFramePredicate
+	{
+		bool operator()(const FEntry& A, const FEntry& B) const
+		{
+			return A.DueTick < B.DueTick;
+		}
+	};
+
+	TArray<FEntry> Entries;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
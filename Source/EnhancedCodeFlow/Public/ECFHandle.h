@@ -27,6 +27,24 @@ public:
 		Other.Invalidate();
 	}
 
+	// Creates a handle pointing to the given slot of the given generation.
+	FECFHandle(uint32 InSlotIndex, uint32 InGeneration) :
+		Handle((static_cast<uint64>(InGeneration) << 32) | static_cast<uint64>(InSlotIndex))
+	{
+	}
+
+	// Returns the index of the slot this handle points to.
+	uint32 GetSlotIndex() const
+	{
+		return static_cast<uint32>(Handle & 0xFFFFFFFF);
+	}
+
+	// Returns the generation of the slot this handle was created for.
+	uint32 GetGeneration() const
+	{
+		return static_cast<uint32>(Handle >> 32);
+	}
+
 	// Checks if the handle is valid.
 	bool IsValid() const
 	{
@@ -66,19 +84,18 @@ public:
 		return *this;
 	}
 
-	// Increase handle.
-	FECFHandle& operator++()
-	{
-		Handle++;
-		return *this;
-	}
-
 	// Convert the handle to string.
 	FString ToString() const
 	{
 		return FString::Printf(TEXT("%llu"), Handle);
 	}
 
+	// Hash of the handle, so it can be used as a key in maps and sets.
+	friend uint32 GetTypeHash(const FECFHandle& InHandle)
+	{
+		return ::GetTypeHash(InHandle.Handle);
+	}
+
 protected:
 
 	uint64 Handle;
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFHandle.h"
+#include <atomic>
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Table of generations of the action slots used by the ECF subsystem.
+ * Every action handle points to a slot and stores the generation of this slot from the moment the action
+ * has been created. When the action is removed the generation of its slot is increased, so checking if 
+ * the handle is still running is just a bounds check and a generation compare.
+ * The table is stored in chunks that are never moved, so it can be safely read from any thread.
+ * Writing to the table is allowed only on the Game Thread.
+ */
+class ENHANCEDCODEFLOW_API FECFHandleGenerations
+{
+
+public:
+
+	FECFHandleGenerations();
+	~FECFHandleGenerations();
+
+	FECFHandleGenerations(const FECFHandleGenerations&) = delete;
+	FECFHandleGenerations& operator=(const FECFHandleGenerations&) = delete;
+
+	// Checks if the action pointed by the given handle is still running. Can be called from any thread.
+	// Have in mind that the finished action is treated as running until the ECF subsystem removes it,
+	// which happens during the next ECF tick.
+	bool IsActionRunning(const FECFHandle& Handle) const;
+
+	// Returns the current generation of the given slot. Returns 0 if the slot was never used.
+	uint32 GetGeneration(uint32 SlotIndex) const;
+
+	// Sets the generation of the given slot. Game Thread only.
+	void SetGeneration(uint32 SlotIndex, uint32 Generation);
+
+	// Size of one chunk of generations.
+	static constexpr uint32 ChunkSize = 4096;
+
+	// Maximum number of chunks.
+	static constexpr uint32 MaxChunks = 4096;
+
+	// Maximum number of slots (and so the maximum number of actions running at the same time).
+	static constexpr uint32 MaxSlots = ChunkSize * MaxChunks;
+
+private:
+
+	// Chunks of generations. Chunks are allocated when needed and released only when the table is destroyed.
+	std::atomic<std::atomic<uint32>*> Chunks[MaxChunks];
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -78,6 +78,12 @@ public:
 	// Returns a new id.
 	static FECFInstanceId NewId();
 
+	// Hash of the Id, so it can be used as a key in maps and sets.
+	friend uint32 GetTypeHash(const FECFInstanceId& InInstanceId)
+	{
+		return ::GetTypeHash(InInstanceId.Id);
+	}
+
 protected:
 
 	uint64 Id;
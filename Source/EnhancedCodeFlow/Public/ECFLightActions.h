@@ -0,0 +1,147 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/ObjectKey.h"
+#include "ECFHandle.h"
+#include "ECFCallback.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Storage of light actions of one type. Light actions are plain structs, not UObjects, so they
+ * are not tracked by the garbage collector at all.
+ * Items are kept in chunks that are never moved, so references to them stay valid when new items are added.
+ * Indices of removed items are reused by the next items.
+ */
+template<typename T, int32 ChunkSize = 1024>
+class TECFLightActionArena
+{
+
+public:
+
+	// Adds the given item and returns its index.
+	int32 Add(T&& Item)
+	{
+		int32 Index = INDEX_NONE;
+		if (FreeIndices.Num() > 0)
+		{
+			Index = FreeIndices.Pop();
+		}
+		else
+		{
+			Index = AllocatedFlags.Add(false);
+			if ((Index % ChunkSize) == 0)
+			{
+				Chunks.Add(MakeUnique<T[]>(ChunkSize));
+			}
+		}
+
+		(*this)[Index] = MoveTemp(Item);
+		AllocatedFlags[Index] = true;
+		ItemsNum++;
+		return Index;
+	}
+
+	// Removes the item of the given index. The item is reset, so it releases everything it holds.
+	void Remove(int32 Index)
+	{
+		check(IsAllocated(Index));
+
+		(*this)[Index] = T();
+		AllocatedFlags[Index] = false;
+		FreeIndices.Add(Index);
+		ItemsNum--;
+	}
+
+	// Removes all items and releases the memory.
+	void Empty()
+	{
+		Chunks.Empty();
+		AllocatedFlags.Empty();
+		FreeIndices.Empty();
+		ItemsNum = 0;
+	}
+
+	// Checks if there is an item of the given index.
+	bool IsAllocated(int32 Index) const
+	{
+		return AllocatedFlags.IsValidIndex(Index) && AllocatedFlags[Index];
+	}
+
+	// Returns the number of items.
+	int32 Num() const
+	{
+		return ItemsNum;
+	}
+
+	// Returns the index after the last item that has ever been added. Use it to iterate through all items.
+	int32 GetMaxIndex() const
+	{
+		return AllocatedFlags.Num();
+	}
+
+	T& operator[](int32 Index)
+	{
+		return Chunks[Index / ChunkSize][Index % ChunkSize];
+	}
+
+	const T& operator[](int32 Index) const
+	{
+		return Chunks[Index / ChunkSize][Index % ChunkSize];
+	}
+
+private:
+
+	TArray<TUniquePtr<T[]>> Chunks;
+	TBitArray<> AllocatedFlags;
+	TArray<int32> FreeIndices;
+	int32 ItemsNum = 0;
+};
+
+/**
+ * Light version of the Delay action, used by the C++ API when the delay doesn't need any action settings
+ * that require ticking. It is never ticked - it only waits in the timer wheel of its time lane.
+ */
+struct FECFLightDelay
+{
+	// Handle of this delay.
+	FECFHandle Handle;
+
+	// Owner of this delay. The callback is not called if the owner is not valid anymore.
+	TWeakObjectPtr<const UObject> Owner;
+
+	// Key of the owner, used to find delays of the given owner.
+	FObjectKey OwnerKey;
+
+	// Function called when the delay ends or when it is stopped with completion.
+	TECFCallback<void(bool), void()> CallbackFunc;
+
+	// Label of this delay.
+	FString Label;
+
+	// Time of the lane when the delay ends. Not used when the delay is paused.
+	double DueTime = 0.0;
+
+	// Whole time of the delay.
+	float DelayTime = 0.f;
+
+	// Time left to the end of the delay. Used only when the delay is paused.
+	float TimeLeft = 0.f;
+
+	// Id of the current timer wheel entry, used to ignore outdated entries.
+	uint32 SleepId = 0;
+
+	// Index of the clock used by this delay.
+	uint8 ClockIndex = 0;
+
+	// Index of the time lane of the clock used by this delay.
+	uint8 TimeLaneIndex = 0;
+
+	// Indicates if this delay is paused.
+	bool bIsPaused = false;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
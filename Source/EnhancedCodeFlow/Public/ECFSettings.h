@@ -0,0 +1,58 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "ECFActionBase.h"
+#include "ECFSettings.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+// Project settings of the Enhanced Code Flow.
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Enhanced Code Flow"))
+class ENHANCEDCODEFLOW_API UECFSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+
+	UECFSettings();
+
+	// If enabled, delays started from C++ without the first delay and the tick interval are handled without
+	// creating action objects. Such delays can be controlled with their handles, but they can't be obtained as actions.
+	// Disabled by default, as GetActionFromHandle, GetAllActions and GetActionsOfClass don't return light delays.
+	UPROPERTY(Config, EditAnywhere, Category = "Performance")
+	bool bUseLightDelays = false;
+
+	// Time in milliseconds the subsystem can spend on ticking actions in one frame. Critical actions are always ticked,
+	// actions of other priorities are deferred to the next frames when the budget is spent. 0 means no budget.
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0", Units = "ms"))
+	float TickBudgetMs = 0.f;
+
+	// Maximum number of async tasks (like RunAsyncThen tasks) running on worker threads at once. Tasks above the limit
+	// wait in the queues of their priorities and their timeouts don't pass while they wait. 0 means no limit.
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0"))
+	int32 MaxAsyncTasksInFlight = 0;
+
+	// Maximum number of threads, including the game thread, ticking thread-safe actions of one class in parallel.
+	// 0 means all worker threads.
+	UPROPERTY(Config, EditAnywhere, Category = "Performance", meta = (ClampMin = "0"))
+	int32 MaxParallelTickThreads = 0;
+
+	// If enabled, finished actions are kept in pools of their classes and reused by the next actions,
+	// instead of creating new objects every time. Only actions which support pooling are pooled.
+	// Disabled by default, as actions obtained with their handles can be reused by other actions after they have finished.
+	UPROPERTY(Config, EditAnywhere, Category = "Pooling")
+	bool bUseActionsPool = false;
+
+	// Maximum number of finished actions kept in the pool of one class.
+	UPROPERTY(Config, EditAnywhere, Category = "Pooling", meta = (ClampMin = "0", EditCondition = "bUseActionsPool"))
+	int32 MaxPooledActionsPerClass = 256;
+
+	// Number of actions of the given classes created when the game starts, so they don't have to be created during the gameplay.
+	UPROPERTY(Config, EditAnywhere, Category = "Pooling", meta = (EditCondition = "bUseActionsPool"))
+	TMap<TSubclassOf<UECFActionBase>, int32> PrewarmedActions;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -9,6 +9,16 @@ DECLARE_STATS_GROUP(TEXT("ECF"), STATGROUP_ECF, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("ECFDetails"), STATGROUP_ECFDETAILS, STATCAT_Advanced);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actions"), STAT_ECF_ActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Instances"), STAT_ECF_InstancesCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sleeping Actions"), STAT_ECF_SleepingActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pooled Actions"), STAT_ECF_PooledActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Light Actions"), STAT_ECF_LightActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Actions"), STAT_ECF_DeferredActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Completions"), STAT_ECF_CompletionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Completion Latency (ms)"), STAT_ECF_CompletionLatency, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Queue Depth"), STAT_ECF_AsyncQueueDepth, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Tasks In Flight"), STAT_ECF_AsyncTasksInFlight, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Async Wait Time (ms)"), STAT_ECF_AsyncWaitTime, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Async Run Time (ms)"), STAT_ECF_AsyncRunTime, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Action Objects"), STAT_ECF_ActionsObjectsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Async BP Objects"), STAT_ECF_AsyncBPObjectsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 #endif
@@ -5,10 +5,22 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Tickable.h"
+#include "Engine/EngineBaseTypes.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
 #include "ECFHandle.h"
+#include "ECFHandleGenerations.h"
+#include "ECFCommandQueue.h"
+#include "ECFCompletionQueue.h"
+#include "ECFTimerWheel.h"
+#include "ECFFrameQueue.h"
+#include "ECFLightActions.h"
 #include "ECFActionBase.h"
 #include "ECFInstanceId.h"
 #include "ECFActionSettings.h"
+#include "ECFTypes.h"
+#include "ECFClocks.h"
+#include "ECFTickContext.h"
 #include "ECFStats.h"
 #include "Coroutines/ECFCoroutine.h"
 #include "ECFLogs.h"
@@ -16,6 +28,124 @@
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
+// Running actions of the same class, using the same clock and tick group and ignoring (or not) the pause.
+// Actions are ticked bucket by bucket, so every action of the given type is ticked together, and actions that
+// can't be ticked because of the pause can be skipped all at once.
+USTRUCT()
+struct ENHANCEDCODEFLOW_API FECFActionsBucket
+{
+	GENERATED_BODY()
+
+	// Class of all actions in this bucket.
+	UPROPERTY(Transient)
+	UClass* Class = nullptr;
+
+	// Index of the clock used by all actions in this bucket.
+	uint8 ClockIndex = 0;
+
+	// Indicates if actions in this bucket ignore the pause.
+	bool bIgnorePause = false;
+
+	// Tick group in which actions of this bucket are ticked.
+	EECFTickGroup TickGroup = EECFTickGroup::Default;
+
+	// Priority of actions in this bucket.
+	EECFPriority Priority = EECFPriority::Normal;
+
+	// Indicates if actions in this bucket are ticked in parallel.
+	bool bThreadSafeTick = false;
+
+	// Running actions of the given class. Awake actions are kept at the beginning of the array,
+	// sleeping actions are kept after them.
+	UPROPERTY(Transient)
+	TArray<UECFActionBase*> Actions;
+
+	// Number of awake actions.
+	int32 AwakeNum = 0;
+
+	// Adds the given action as an awake one.
+	void AddAwake(UECFActionBase* Action);
+
+	// Adds the given action as a sleeping one.
+	void AddSleeping(UECFActionBase* Action);
+
+	// Removes the awake action of the given index. The order of actions is not kept.
+	void RemoveAwake(int32 Index);
+
+	// Moves the awake action of the given index to the sleeping ones.
+	void FallAsleep(int32 Index);
+
+	// Moves the given sleeping action to the awake ones.
+	void WakeUp(UECFActionBase* Action);
+
+	// Moves awake actions starting from the given index to the beginning of the awake actions, so they are ticked first.
+	void MoveToFront(int32 FirstIndex);
+
+private:
+
+	void SwapActions(int32 IndexA, int32 IndexB);
+};
+
+// Key of the bucket of actions.
+struct FECFActionsBucketKey
+{
+	UClass* Class = nullptr;
+	uint8 ClockIndex = 0;
+	bool bIgnorePause = false;
+	EECFTickGroup TickGroup = EECFTickGroup::Default;
+	EECFPriority Priority = EECFPriority::Normal;
+	bool bThreadSafeTick = false;
+
+	bool operator==(const FECFActionsBucketKey& Other) const
+	{
+		return (Class == Other.Class) && (ClockIndex == Other.ClockIndex) && (bIgnorePause == Other.bIgnorePause) && (TickGroup == Other.TickGroup) && (Priority == Other.Priority) && (bThreadSafeTick == Other.bThreadSafeTick);
+	}
+
+	friend uint32 GetTypeHash(const FECFActionsBucketKey& Key)
+	{
+		return HashCombine(PointerHash(Key.Class), (Key.bThreadSafeTick ? (1u << 15) : 0u) | (static_cast<uint32>(Key.Priority) << 12) | (static_cast<uint32>(Key.TickGroup) << 9) | (static_cast<uint32>(Key.ClockIndex) << 1) | (Key.bIgnorePause ? 1u : 0u));
+	}
+};
+
+class UECFSubsystem;
+
+// Tick function ticking actions of one tick group of the ECF subsystem with the given tick group of the engine.
+USTRUCT()
+struct ENHANCEDCODEFLOW_API FECFTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// Subsystem which actions are ticked.
+	UECFSubsystem* Subsystem = nullptr;
+
+	// Tick group of actions ticked by this function.
+	EECFTickGroup ActionsTickGroup = EECFTickGroup::Default;
+
+	/** FTickFunction interface implementation */
+	void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	FString DiagnosticMessage() override;
+	FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FECFTickFunction> : public TStructOpsTypeTraitsBase2<FECFTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+// Finished actions of the same class, ready to be reused.
+USTRUCT()
+struct ENHANCEDCODEFLOW_API FECFActionsPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<UECFActionBase*> Actions;
+};
+
 UCLASS()
 class ENHANCEDCODEFLOW_API UECFSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
@@ -23,6 +153,7 @@ class ENHANCEDCODEFLOW_API UECFSubsystem : public UGameInstanceSubsystem, public
 
 	friend class FEnhancedCodeFlow;
 	friend class FECFCoroutineAwaiter;
+	friend struct FECFTickFunction;
 
 protected:
 
@@ -33,7 +164,7 @@ protected:
 	/** FTickableGameObject interface implementation */
 	void Tick(float DeltaTime) override;
 	TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(ECFSubsystem, STATGROUP_Tickables); }
-	bool IsTickable() const override { return bCanTick; }
+	bool IsTickable() const override;
 	bool IsTickableWhenPaused() const override { return true; }
 
 	// Add Action to list. Returns the Action id.
@@ -44,9 +175,9 @@ protected:
 		if (IsInGameThread() == false)
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Actions must be started from the Game Thread!"));
+			UE_LOG(LogECF, Error, TEXT("ECF Actions must be started from the Game Thread! Use the ECF command queue to start them from other threads."));
 #endif
-			checkf(false, TEXT("ECF Actions must be started from the Game Thread!"));
+			checkf(false, TEXT("ECF Actions must be started from the Game Thread! Use the ECF command queue to start them from other threads."));
 			return FECFHandle();
 		}
 
@@ -61,20 +192,36 @@ protected:
 		}
 
 		// Otherwise, create and set new action.
-		T* NewAction = NewObject<T>(this);
-		NewAction->SetAction(InOwner, ++LastHandleId, InstanceId, Settings);
+		T* NewAction = CreateAction<T>();
+		const FECFHandle NewHandle = AllocateHandle(NewAction);
+		if (NewHandle.IsValid() == false)
+		{
+			return FECFHandle();
+		}
+
+		NewAction->SetAction(InOwner, NewHandle, InstanceId, Settings);
+		NewAction->CompletionQueue = CompletionQueue;
+		NewAction->ClockIndex = FindOrAddClock(Settings.Clock);
+		NewAction->TickLaneTime = GetTimeLane(NewAction).Time;
+		NewAction->bIsEventAction = T::bIsEventOnly;
+		NewAction->bThreadSafeTick = Settings.bThreadSafeTick && T::bSupportsThreadSafeTick;
 		if (NewAction->Setup(Forward<Ts>(Args)...))
 		{
 			NewAction->Init();
 			PendingAddActions.Add(NewAction);
+			RegisterActionOwner(NewAction);
+			if (InstanceId.IsValid())
+			{
+				InstancedActions.Add(InstanceId, NewHandle);
+			}
 #if (ECF_LOGS && ECF_LOGS_VERBOSE)
 			if (InstanceId.IsValid())
 			{
-				UE_LOG(LogECF, Verbose, TEXT("Started Instanced Action of class: %s, with HandleId: %s, and InstanceId: %s, Label: %s"), *NewAction->GetName(), *LastHandleId.ToString(), *InstanceId.ToString(), *Settings.Label);
+				UE_LOG(LogECF, Verbose, TEXT("Started Instanced Action of class: %s, with HandleId: %s, and InstanceId: %s, Label: %s"), *NewAction->GetName(), *NewHandle.ToString(), *InstanceId.ToString(), *Settings.Label);
 			}
 			else
 			{
-				UE_LOG(LogECF, Verbose, TEXT("Started Action of class: %s, with HandleId: %s, Label: %s"), *NewAction->GetName(), *LastHandleId.ToString(), *Settings.Label);
+				UE_LOG(LogECF, Verbose, TEXT("Started Action of class: %s, with HandleId: %s, Label: %s"), *NewAction->GetName(), *NewHandle.ToString(), *Settings.Label);
 			}
 #endif
 			return NewAction->GetHandleId();
@@ -84,6 +231,8 @@ protected:
 #if ECF_LOGS
 			UE_LOG(LogECF, Error, TEXT("Failed to Setup Action of class: %s, Label: %s"), *NewAction->GetName(), *Settings.Label);
 #endif
+			ReleaseHandle(NewHandle);
+			ReturnActionToPool(NewAction);
 		}
 
 		// If the action couldn't be created for any reason - return invalid id.
@@ -105,8 +254,17 @@ protected:
 		}
 
 		// Create and set new coroutine action.
-		T* NewAction = NewObject<T>(this);
-		NewAction->SetCoroutineAction(InOwner, InCoroutineHandle, ++LastHandleId, Settings);
+		T* NewAction = CreateAction<T>();
+		const FECFHandle NewHandle = AllocateHandle(NewAction);
+		if (NewHandle.IsValid() == false)
+		{
+			return;
+		}
+
+		NewAction->SetCoroutineAction(InOwner, InCoroutineHandle, NewHandle, Settings);
+		NewAction->CompletionQueue = CompletionQueue;
+		NewAction->ClockIndex = FindOrAddClock(Settings.Clock);
+		NewAction->TickLaneTime = GetTimeLane(NewAction).Time;
 		if (NewAction->Setup(Forward<Ts>(Args)...))
 		{
 			NewAction->Init();
@@ -114,15 +272,37 @@ protected:
 			UE_LOG(LogECF, Verbose, TEXT("Started Coroutine Action of class: %s, Label: %s"), *NewAction->GetName(), *Settings.Label);
 #endif
 			PendingAddActions.Add(NewAction);
+			RegisterActionOwner(NewAction);
 		}
 		else
 		{
 #if ECF_LOGS
 			UE_LOG(LogECF, Error, TEXT("Failed to Setup Coroutine Action of class: %s, Label: %s"), *NewAction->GetName(), *Settings.Label);
 #endif
+			ReleaseHandle(NewHandle);
+			ReturnActionToPool(NewAction);
 		}
 	}
 
+	// Takes the action of the given class from the pool, or creates a new one if the pool is empty.
+	template<typename T>
+	T* CreateAction()
+	{
+		if (UECFActionBase* PooledAction = TakeActionFromPool(T::StaticClass()))
+		{
+			ReusedActionsNum++;
+			return static_cast<T*>(PooledAction);
+		}
+		CreatedActionsNum++;
+		return NewObject<T>(this);
+	}
+
+	// Checks if the delay with the given settings can be handled as a light delay, without creating an action object.
+	bool CanUseLightDelay(const FECFActionSettings& Settings) const;
+
+	// Adds the light delay. Returns its handle or invalid handle if the delay couldn't be started.
+	FECFHandle AddLightDelay(const UObject* InOwner, const FECFActionSettings& Settings, float InDelayTime, TECFCallback<void(bool), void()>&& InCallbackFunc);
+
 	// Try to find running or pending action based on it's handle.
 	UECFActionBase* FindAction(const FECFHandle& HandleId) const;
 
@@ -144,9 +324,25 @@ protected:
 	// Returns the number of all running and pending actions. Use it mostly for debugging purposes.
 	int32 GetActionsCount() const;
 
+	// Returns the number of actions deferred during the previous frame, because the tick budget has been spent.
+	int32 GetDeferredActionsCount() const { return LastFrameDeferredActionsNum; }
+
+	// Returns the longest time (in seconds) the completions of async work waited for the Game Thread,
+	// measured in the last frame which handled any completions.
+	double GetCompletionLatency() const { return LastCompletionLatency; }
+
+	// Returns the statistics of the pools of finished actions.
+	FECFActionsPoolStats GetActionsPoolStats() const;
+
 	// Check if the action is running or pending to run.
 	bool HasAction(const FECFHandle& HandleId) const;
 
+	// Returns the table of generations of action slots, which can be read from any thread.
+	TSharedPtr<const FECFHandleGenerations, ESPMode::ThreadSafe> GetHandleGenerations() const { return Generations; }
+
+	// Returns the queue of commands, which can be submitted from any thread.
+	TSharedPtr<FECFCommandQueue, ESPMode::ThreadSafe> GetCommandQueue() const { return CommandQueue; }
+
 	// Pause ticking in this action
 	void PauseAction(const FECFHandle& HandleId);
 
@@ -191,20 +387,217 @@ protected:
 
 	// Check if there is an instanced action running with the given instance id and returns it.
 	UECFActionBase* GetInstancedAction(const FECFInstanceId& InstanceId, bool bPrintErrorIfFailed = true) const;
+
+	// Pauses or resumes the given clock.
+	void SetClockPaused(FName ClockName, bool bPaused);
+
+	// Checks if the given clock is paused.
+	bool IsClockPaused(FName ClockName) const;
+
+	// Sets the scale of the time of the given clock.
+	void SetClockTimeScale(FName ClockName, float TimeScale);
+
+	// Returns the scale of the time of the given clock.
+	float GetClockTimeScale(FName ClockName) const;
 	
-	// List of active actions.
+	// Buckets of active actions, one for every class of action, clock and pause setting used by running actions.
 	UPROPERTY(Transient)
-	TArray<UECFActionBase*> Actions;
+	TArray<FECFActionsBucket> ActionBuckets;
+
+	// Indices of buckets by their keys.
+	TMap<FECFActionsBucketKey, int32> ActionBucketIndices;
+
+	// Pools of finished actions of the given classes.
+	UPROPERTY(Transient)
+	TMap<UClass*, FECFActionsPool> ActionPools;
 
 	// List of nodes to be add in the future.
 	UPROPERTY(Transient)
 	TArray<UECFActionBase*> PendingAddActions;
 
-	// Id of the last created node.
-	FECFHandle LastHandleId;
+	// Slots of running and pending actions. Every action handle points to one of these slots.
+	// Slots are taken when actions are created and released when actions are purged from the lists above.
+	UPROPERTY(Transient)
+	TArray<UECFActionBase*> Slots;
+
+	// Indices of slots that can be reused.
+	TArray<uint32> FreeSlots;
+
+	// Generations of slots. Shared, so it can be read from other threads.
+	TSharedPtr<FECFHandleGenerations, ESPMode::ThreadSafe> Generations;
+
+	// Commands submitted from any thread. Shared, so it can be used by other threads.
+	TSharedPtr<FECFCommandQueue, ESPMode::ThreadSafe> CommandQueue;
+
+	// Handle reserved for the action started by the currently executed command. Used by the next allocated handle.
+	FECFHandle ReservedHandleToUse;
+
+	// Completions of the work awaited by actions, pushed from any thread. Shared, so it can be used by other threads.
+	TSharedPtr<FECFCompletionQueue, ESPMode::ThreadSafe> CompletionQueue;
+
+	// The longest time the completions waited for the Game Thread, in the last frame which handled any completions.
+	double LastCompletionLatency = 0.0;
+
+	// Handles of running and pending actions of the given owner.
+	struct FECFOwnerActions
+	{
+		TArray<FECFHandle> Handles;
+
+		// Indicates if the subsystem is bound to the OnEndPlay of the owner (when it is an actor).
+		bool bBoundToEndPlay = false;
+	};
+
+	// Running and pending actions by their owners, so actions of the given owner can be found without
+	// checking all actions. Entries of destroyed owners are removed when owners end play or after garbage collection.
+	TMap<FObjectKey, FECFOwnerActions> ActionsByOwner;
+
+	// Handle of the post garbage collection callback.
+	FDelegateHandle PostGarbageCollectHandle;
+
+	// Time and frames used by actions that ignore (or not) the game pause and the global time dilation.
+	// Sleeping actions are kept in the timer wheel or the frame queue of their time lane.
+	struct FECFTimeLane
+	{
+		// Current time of the lane.
+		double Time = 0.0;
+
+		// Time of the lane before the last advance.
+		double PreviousTime = 0.0;
+
+		// Number of frames the lane has advanced.
+		uint64 Frame = 0;
+
+		// Sleeping actions waiting for the lane time.
+		FECFTimerWheel Wheel;
+
+		// Sleeping actions waiting for the lane frame.
+		FECFFrameQueue FrameQueue;
+	};
+
+	// Number of time lanes of every clock, one for every combination of ignoring the pause and the time dilation.
+	static constexpr int32 TimeLanesNum = 4;
+
+	// Clock of actions, which can be paused and have its time scaled. Pausing and scaling a clock
+	// only changes how its time lanes advance, so it doesn't matter how many actions use it.
+	struct FECFClock
+	{
+		FName Name;
+
+		// Indicates if the clock is paused. Actions of the paused clock are not visited at all.
+		bool bIsPaused = false;
+
+		// Scale of the time of the clock.
+		float TimeScale = 1.f;
+
+		// Indicates if the clock runs when the world is paused, no matter what its actions ignore.
+		bool bIgnoreWorldPause = false;
+
+		// Indicates if the clock ignores the global time dilation, no matter what its actions ignore.
+		bool bIgnoreWorldTimeDilation = false;
+
+		// Time lanes of this clock.
+		FECFTimeLane Lanes[TimeLanesNum];
+	};
+
+	// Maximum number of clocks.
+	static constexpr int32 MaxClocksNum = 32;
+
+	// Clocks of actions. Clocks are never moved nor removed, so their time lanes can be referenced while new clocks are added.
+	TArray<TUniquePtr<FECFClock>> Clocks;
+
+	// Indices of clocks by their names.
+	TMap<FName, uint8> ClockIndices;
+
+	// State of the world for the current frame as seen by every clock. Kept between frames, so it doesn't allocate.
+	TArray<FECFTickContext> ClockTickContexts;
+
+	// Actions that have been woken up and should be moved to the awake actions during the next tick.
+	TArray<FECFHandle> WakingUpActions;
+
+	// Buffer for entries of timer wheels that are due.
+	TArray<FECFTimerWheel::FEntry> DueSleepEntries;
+
+	// Light delays, which don't need action objects.
+	TECFLightActionArena<FECFLightDelay> LightDelays;
+
+	// Indices of light delays in the arena for every slot. INDEX_NONE if the slot is not used by a light delay.
+	TArray<int32> LightDelayIndices;
+
+	// Timer wheel entries of light delays that are due and will be finished during this tick.
+	TArray<FECFTimerWheel::FEntry> DueLightDelays;
+
+	// Buffer for light delays being finished, as their callbacks can add new due delays.
+	TArray<FECFTimerWheel::FEntry> FiringLightDelays;
+
+	// Indicates if simple delays should be handled as light delays (from the project settings).
+	bool bUseLightDelays = false;
+
+	// Handles of running and pending instanced actions by their InstanceIds.
+	// Entries are removed when their actions are purged, or replaced when a new action with the same InstanceId is started.
+	TMap<FECFInstanceId, FECFHandle> InstancedActions;
+
+	// Number of frames between checks if buffers can be shrunk.
+	static constexpr int32 BuffersShrinkInterval = 600;
+
+	// Number of frames since buffers were last checked for shrinking.
+	int32 FramesSinceBuffersShrink = 0;
+
+	// Highest numbers of elements used by the buffers which are reset every frame, since buffers were last checked for shrinking.
+	// Such buffers are always empty when they are checked, so they are shrunk by these numbers instead.
+	int32 PendingAddActionsPeak = 0;
+	int32 WakingUpActionsPeak = 0;
+	int32 DueSleepEntriesPeak = 0;
+
+	// Due and firing light delays swap their buffers, so they share the peak.
+	int32 LightDelayBuffersPeak = 0;
+
+	// Maximum number of threads ticking a bucket in parallel, 0 means all workers and the game thread (from the project settings).
+	int32 MaxParallelTickThreadsNum = 0;
+
+	// Indicates if finished actions should be pooled (from the project settings).
+	bool bUseActionsPool = false;
+
+	// Maximum number of pooled actions of one class (from the project settings).
+	int32 MaxPooledActionsPerClass = 0;
+
+	// Numbers of actions taken from the pools and created, because the pools were empty.
+	int32 ReusedActionsNum = 0;
+	int32 CreatedActionsNum = 0;
 
 	// Indicates if subsystem is paused
 	bool bIsECFPaused = false;
+
+	// Number of tick groups of actions, including the Default one ticked by the subsystem itself.
+	static constexpr int32 TickGroupsNum = static_cast<int32>(EECFTickGroup::PostUpdateWork) + 1;
+
+	// Tick functions of tick groups other than the Default one. They are registered only when their groups have work.
+	FECFTickFunction TickFunctions[TickGroupsNum - 1];
+
+	// World in which tick functions are registered.
+	TWeakObjectPtr<UWorld> TickFunctionsWorld;
+
+	// Handle of the world cleanup callback.
+	FDelegateHandle WorldCleanupHandle;
+
+	// Number of the last frame that has been prepared for ticking.
+	uint64 LastPreparedFrame = MAX_uint64;
+
+	// Time the subsystem can spend on ticking actions in one frame (from the project settings). 0 means no budget.
+	double TickBudgetSeconds = 0.0;
+
+	// Time left from the tick budget of the current frame.
+	double FrameBudgetLeft = 0.0;
+
+	// Number of priorities of actions.
+	static constexpr int32 PrioritiesNum = static_cast<int32>(EECFPriority::Background) + 1;
+
+	// Index of the bucket from which ticking of actions of the given tick group and priority starts,
+	// so actions deferred because of the budget are ticked first in the next frame.
+	int32 BudgetCursors[TickGroupsNum][PrioritiesNum] = {};
+
+	// Number of actions deferred during the current frame and the previous one.
+	int32 DeferredActionsNum = 0;
+	int32 LastFrameDeferredActionsNum = 0;
 	
 	// Getter handling.
 	static UECFSubsystem* Get(const UObject* WorldContextObject);
@@ -215,6 +608,205 @@ protected:
 	// Utility function to check action validity.
 	static bool IsActionValid(UECFActionBase* Action);
 
+	// Cheaper version of IsActionValid used during ticking. Actions of owners which notify
+	// about their teardown don't have to check their owners.
+	static bool IsActionAlive(UECFActionBase* Action);
+
+	// Checks if the action is not valid anymore. If so - releases its slot.
+	// Used when purging action lists.
+	bool PurgeInvalidAction(UECFActionBase* Action);
+
+	// Removes the action from the instanced actions and the actions of its owner and releases its slot.
+	void ForgetAction(UECFActionBase* Action);
+
+	// Executes commands submitted from any thread.
+	void ExecuteCommands();
+
+	// Reserves handles for actions started from other threads, up to the capacity of the command queue.
+	void ReserveHandles();
+
+	// Takes completions pushed from any thread and wakes up the actions waiting for them.
+	void DrainCompletions();
+
+	// Takes a free slot for the given action and returns the handle pointing to it.
+	// Returns invalid handle if there are no more slots available.
+	FECFHandle AllocateHandle(UECFActionBase* Action);
+
+	// Releases the slot pointed by the given handle. The handle (and its copies) becomes invalid.
+	void ReleaseHandle(const FECFHandle& HandleId);
+
+	// Returns the action from the slot pointed by the given handle or nullptr if the handle is outdated.
+	UECFActionBase* GetActionFromSlot(const FECFHandle& HandleId) const;
+
+	// Checks if the slot pointed by the given handle is still used by the action of this handle.
+	bool IsHandleCurrent(const FECFHandle& HandleId) const;
+
+	// Returns the light delay of the given handle or nullptr if there is no such delay.
+	FECFLightDelay* FindLightDelay(const FECFHandle& HandleId);
+	const FECFLightDelay* FindLightDelay(const FECFHandle& HandleId) const;
+
+	// Returns handles of light delays of the given owner, or of all of them if the owner is not specified.
+	TArray<FECFHandle> GetLightDelaysOfOwner(const UObject* InOwner) const;
+
+	// Schedules the light delay to end after the given time.
+	void ScheduleLightDelay(FECFLightDelay& LightDelay, float TimeLeft);
+
+	// Pauses or resumes the light delay.
+	void SetLightDelayPaused(FECFLightDelay& LightDelay, bool bPaused);
+
+	// Returns the time that has passed since the light delay started.
+	float GetLightDelayTime(const FECFLightDelay& LightDelay) const;
+
+	// Removes the light delay and calls its callback if needed. The delay can't be used after this call.
+	void FinishLightDelay(FECFLightDelay& LightDelay, bool bComplete, bool bStopped);
+
+	// Removes the light delay without calling its callback and releases its handle.
+	// If bForgetOwner is true, the delay is also removed from the actions of its owner.
+	void RemoveLightDelay(FECFLightDelay& LightDelay, bool bForgetOwner);
+
+	// Finishes light delays which are due.
+	void FireDueLightDelays();
+
+	// Prepares the frame for ticking actions, if it hasn't been prepared yet. The first tick group ticking
+	// in the frame advances the time, wakes up and adds pending actions for all tick groups.
+	void PrepareFrame(float DeltaTime);
+
+	// Ticks awake actions of the given tick group. Critical actions are ticked first, then the other ones
+	// round-robin, until the tick budget is spent. The delta time must not be dilated by the world.
+	void TickActions(EECFTickGroup TickGroup, float DeltaTime);
+
+	// Ticks awake actions of the bucket until the given time. The rest of actions are deferred.
+	// Returns false if the time has been reached before all actions were ticked.
+	bool TickBucket(FECFActionsBucket& Bucket, double BudgetEndTime);
+
+	// Ticks awake thread-safe actions of the bucket in parallel, in chunks taken in order until the given time.
+	// Actions are validated before and updated after the parallel ticks on the game thread, in the order of the bucket,
+	// so completions are called in the same order as they would be by the serial tick. Actions of chunks which haven't
+	// been ticked are deferred. Returns false if the time has been reached before all actions were ticked.
+	bool TickBucketInParallel(FECFActionsBucket& Bucket, double BudgetEndTime);
+
+	// Ticks the awake action with the delta time of the frame, or with the time it has been deferred for.
+	void TickAction(UECFActionBase* Action, const FECFTickContext& ClockTickContext);
+
+	// Updates the action after its tick. Removes it if it has finished, or moves it out of the awake actions
+	// if it doesn't need ticking. Returns true if the action stays awake at the same index.
+	bool UpdateTickedAction(FECFActionsBucket& Bucket, int32 Index);
+
+	// Minimal number of awake actions in the bucket to tick them in parallel. Smaller buckets are ticked on the game thread.
+	static constexpr int32 MinParallelTickActionsNum = 64;
+
+	// Number of actions in a chunk of the parallel tick. The budget is checked before every chunk.
+	static constexpr int32 ParallelTickChunkSize = 32;
+
+	// Checks if actions of the bucket can be ticked in this frame, considering pauses of the world and the clock.
+	bool CanTickBucket(const FECFActionsBucket& Bucket) const;
+
+	// Defers awake actions of the bucket starting from the given index to the next frame.
+	void DeferActions(FECFActionsBucket& Bucket, int32 FirstIndex);
+
+	// Registers and enables tick functions of tick groups that have actions, and disables the other ones.
+	void UpdateTickFunctions();
+
+	// Unregisters all tick functions.
+	void UnregisterTickFunctions();
+
+	// Checks if the given tick group has any actions of clocks that are not paused.
+	bool HasActionsToTick(EECFTickGroup TickGroup) const;
+
+	// Called when a world is cleaned up, to unregister tick functions from it.
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+
+	// Returns the bucket the given action belongs to. Creates one if there is no such bucket.
+	FECFActionsBucket& GetActionsBucket(UECFActionBase* Action);
+
+	// Computes the state of the world for the current frame.
+	FECFTickContext MakeTickContext(float DeltaTime) const;
+
+	// Computes the state of the world for the current frame, as seen by actions of the given clock.
+	static FECFTickContext MakeClockTickContext(const FECFTickContext& TickContext, const FECFClock& Clock);
+
+	// Returns the index of the clock of the given name. Creates the clock if there is no such clock yet.
+	// None means the Gameplay clock.
+	uint8 FindOrAddClock(FName ClockName);
+
+	// Creates clocks defined in FECFClocks.
+	void AddDefaultClocks();
+
+	// Returns the given time lane of the given clock.
+	FECFTimeLane& GetTimeLane(uint8 ClockIndex, int32 LaneIndex);
+	const FECFTimeLane& GetTimeLane(uint8 ClockIndex, int32 LaneIndex) const;
+
+	// Returns the time lane used by the given action.
+	FECFTimeLane& GetTimeLane(const UECFActionBase* Action);
+
+	// Returns the finished action of the given class from its pool or nullptr if there is none.
+	UECFActionBase* TakeActionFromPool(UClass* ActionClass);
+
+	// Resets the finished action and puts it to the pool of its class, if the action supports pooling and the pool is not full.
+	void ReturnActionToPool(UECFActionBase* Action);
+
+	// Fills pools with the actions defined in the project settings.
+	void PrewarmActionsPools();
+
+	// Returns the number of active actions in all buckets.
+	int32 GetActiveActionsCount() const;
+
+	// Advances time lanes by the delta time of the given frame and wakes up actions that are due.
+	void AdvanceTimeLanes(const FECFTickContext& TickContext);
+
+	// Advances the given time lane of a clock and wakes up actions that are due.
+	void AdvanceTimeLane(FECFTimeLane& Lane, int32 LaneIndex, const FECFTickContext& ClockTickContext);
+
+	// Moves the awake action of the given index in the given bucket to the timer wheel or the frame queue,
+	// if it doesn't have to be ticked for some time. Returns true if the action has fallen asleep.
+	bool TryPutActionToSleep(FECFActionsBucket& Bucket, int32 Index);
+
+	// Wakes up the sleeping action, so it can be ticked again. It will be moved to the awake actions during the next tick.
+	void WakeUpAction(UECFActionBase* Action);
+
+	// Wakes up the dormant (paused) action, so it can be ticked again. It will be moved to the awake actions during the next tick.
+	void WakeUpDormantAction(UECFActionBase* Action);
+
+	// Wakes up the action waiting for the completion, so it is ticked during the next tick.
+	void WakeUpAwaitingAction(UECFActionBase* Action);
+
+	// Wakes up the sleeping, dormant, awaiting or event-only action, so it can be removed during the next tick.
+	void WakeUpRemovedAction(UECFActionBase* Action);
+
+	// Checks if there is any action that must be ticked. Dormant actions don't count.
+	bool HasActionsToTick() const;
+
+	// Ticks the sleeping action with the time (or the ticks) it has slept up to the given time and frame of its lane.
+	void SyncSleepingAction(UECFActionBase* Action, double LaneTime, uint64 LaneFrame);
+
+	// Resets all time lanes.
+	void ResetTimeLanes();
+
+	// Reclaims the memory of buffers that have been left mostly unused after a spike of actions.
+	void ShrinkBuffers();
+
+	// Adds the action to the actions of its owner.
+	void RegisterActionOwner(UECFActionBase* Action);
+
+	// Adds the given handle to the actions of the given owner. Returns true if the owner will notify about its teardown.
+	bool RegisterOwnerHandle(const UObject* InOwner, const FECFHandle& HandleId);
+
+	// Returns valid running and pending actions of the given owner, or all of them if the owner is not specified.
+	TArray<UECFActionBase*> GetActionsOfOwner(const UObject* InOwner) const;
+
+	// Marks all actions of the given owner as torn down and forgets the owner.
+	void TearDownOwnerActions(const FObjectKey& InOwnerKey);
+
+	// Makes actions of the given owner check the owner every tick again, because it won't notify about its teardown.
+	void ForgetOwnerTeardownNotify(const FObjectKey& InOwnerKey);
+
+	// Called when the actor owning actions ends play. Actions are torn down only when the actor is going away.
+	UFUNCTION()
+	void OnOwnerEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	// Called after garbage collection to forget owners that don't exist anymore.
+	void OnPostGarbageCollect();
+
 private:
 
 	// Indicates if this subsystem should tick
@@ -0,0 +1,43 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * State of the world for the current frame. It is the same for every action,
+ * so it is computed once per tick of the subsystem and passed down to the actions.
+ */
+struct FECFTickContext
+{
+	// Delta time of the frame, without the global time dilation.
+	float DeltaTime = 0.f;
+
+	// Delta time of the frame with the global time dilation applied.
+	float DilatedDeltaTime = 0.f;
+
+	// Indicates if the world is paused in this frame.
+	bool bIsWorldPaused = false;
+
+	// Number of the frame.
+	uint64 FrameNumber = 0;
+
+	// Real time of the world in seconds, not affected by pauses nor time dilation.
+	double RealTime = 0.0;
+
+	// Checks if actions that do or don't ignore the pause should be ticked in this frame.
+	bool CanTick(bool bIgnorePause) const
+	{
+		return bIgnorePause || (bIsWorldPaused == false);
+	}
+
+	// Returns the delta time for actions that do or don't ignore the global time dilation.
+	float GetDeltaTime(bool bIgnoreGlobalTimeDilation) const
+	{
+		return bIgnoreGlobalTimeDilation ? DeltaTime : DilatedDeltaTime;
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
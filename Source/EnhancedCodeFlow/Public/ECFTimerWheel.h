@@ -0,0 +1,79 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFHandle.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Hierarchical timing wheel used by the ECF subsystem to keep sleeping actions.
+ * Time is divided into ticks of the given resolution. Every level of the wheel has 256 slots and
+ * every slot of the next level covers all slots of the previous one. Entries are kept in the lowest level
+ * that can fit their due time and are moved to lower levels when the wheel gets close to them, so
+ * scheduling and advancing is constant time per entry, no matter how many entries are waiting.
+ * Entries are released at the beginning of the tick they are due in, so they can be released
+ * up to one resolution earlier than requested.
+ */
+class ENHANCEDCODEFLOW_API FECFTimerWheel
+{
+
+public:
+
+	// Entry of the wheel. Stores the handle of the sleeping action instead of the action itself,
+	// so removed actions can be safely ignored when their entries are due.
+	struct FEntry
+	{
+		FECFHandle Handle;
+		uint32 SleepId = 0;
+		uint64 DueTick = 0;
+	};
+
+	FECFTimerWheel(double InResolution = DefaultResolution);
+
+	// Schedules the entry to be released when the wheel reaches the given time.
+	void Schedule(const FECFHandle& Handle, uint32 SleepId, double DueTime);
+
+	// Moves the wheel to the given time and appends all entries that are due to the given array.
+	void Advance(double NewTime, TArray<FEntry>& OutDueEntries);
+
+	// Removes all entries and moves the wheel back to time 0.
+	void Reset();
+
+	// Returns the number of scheduled entries.
+	int32 Num() const { return EntriesNum; }
+
+	// Returns the length of one tick of the wheel.
+	double GetResolution() const { return Resolution; }
+
+	// Default length of one tick of the wheel.
+	static constexpr double DefaultResolution = 1.0 / 60.0;
+
+	// Number of levels in the wheel.
+	static constexpr int32 LevelsNum = 4;
+
+	// Number of bits used to index slots in one level.
+	static constexpr int32 SlotBits = 8;
+
+	// Number of slots in one level.
+	static constexpr int32 SlotsNum = 1 << SlotBits;
+
+private:
+
+	// Puts the entry to the proper slot, based on how far in the future it is due.
+	void Insert(FEntry&& Entry);
+
+	// Converts the given time to the tick of the wheel.
+	uint64 TimeToTick(double Time) const;
+
+	TArray<FEntry> Slots[LevelsNum][SlotsNum];
+
+	// Buffer for entries moved down from the higher level slot, reused to avoid allocations.
+	TArray<FEntry> CascadedEntries;
+	double Resolution;
+	uint64 CurrentTick = 0;
+	int32 EntriesNum = 0;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
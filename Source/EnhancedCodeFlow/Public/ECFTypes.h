@@ -20,6 +20,24 @@ enum class EECFBlendFunc : uint8
 UENUM(BlueprintType)
 enum class EECFAsyncPrio : uint8
 {
+	// Background thread with normal priority.
 	Normal,
-	HiPriority
-};
\ No newline at end of file
+	// Background thread with high priority.
+	HiPriority,
+	// Background thread with low priority. Use it for long tasks, so they don't delay the other ones.
+	LowPriority,
+	// Foreground thread with high priority. Use it for short tasks which results are needed as soon as possible.
+	Foreground
+};
+// Statistics of the pools of finished actions of one world.
+struct FECFActionsPoolStats
+{
+	// Number of finished actions waiting in the pools.
+	int32 PooledActionsNum = 0;
+
+	// Number of actions taken from the pools instead of being created.
+	int32 ReusedActionsNum = 0;
+
+	// Number of action objects created, because the pools of their classes were empty.
+	int32 CreatedActionsNum = 0;
+};
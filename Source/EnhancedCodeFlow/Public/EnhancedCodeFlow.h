@@ -28,10 +28,16 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "ECFHandle.h"
+#include "ECFHandleGenerations.h"
+#include "ECFCallback.h"
+#include "ECFCommandQueue.h"
 #include "ECFTypes.h"
+#include "ECFAsyncTask.h"
+#include "ECFAsyncPipeline.h"
 #include "ECFActionSettings.h"
 #include "ECFInstanceId.h"
 #include "Coroutines/ECFCoroutineAwaiters.h"
+#include "CodeFlowActions/ECFRunAsyncThen.h"
 #include "ECFConcepts.h"
 
 class ENHANCEDCODEFLOW_API FEnhancedCodeFlow
@@ -46,6 +52,20 @@ public:
 	 */
 	static bool IsActionRunning(const UObject* WorldContextObject, const FECFHandle& Handle);
 
+	/**
+	 * Returns the table of generations of action slots, which can be used to check if the action
+	 * pointed by the handle is running from any thread (FECFHandleGenerations::IsActionRunning).
+	 * The table must be obtained on the Game Thread.
+	 */
+	static TSharedPtr<const FECFHandleGenerations, ESPMode::ThreadSafe> GetHandleGenerations(const UObject* WorldContextObject);
+
+	/**
+	 * Returns the queue of commands, which can be used to start, stop, pause and resume actions from any thread.
+	 * Commands are executed on the Game Thread at the beginning of the next ECF tick.
+	 * The queue must be obtained on the Game Thread.
+	 */
+	static TSharedPtr<FECFCommandQueue, ESPMode::ThreadSafe> GetCommandQueue(const UObject* WorldContextObject);
+
 	/**
 	 * Finds handles of running or pending action of the given Class its FECFHandles.
 	 */
@@ -72,8 +92,32 @@ public:
 	 */
 	static int32 GetActionsCount(const UObject* WorldContextObject);
 
+	/**
+	 * Returns the number of actions deferred during the previous frame, because the tick budget has been spent.
+	 */
+	static int32 GetDeferredActionsCount(const UObject* WorldContextObject);
+
+	/**
+	 * Returns the longest time (in seconds) between the end of async work (like RunAsyncThen tasks) and handling it
+	 * on the game thread, measured in the last frame which handled any of them.
+	 */
+	static double GetCompletionLatency(const UObject* WorldContextObject);
+
+	/**
+	 * Returns the statistics of the executor running async tasks: the number of queued and running tasks,
+	 * and the average time (in seconds) tasks wait in the queue and run. The executor is shared by all worlds.
+	 */
+	static FECFAsyncExecutorStats GetAsyncExecutorStats();
+
+	/**
+	 * Returns the statistics of the pools of finished actions: the number of pooled actions, and the number
+	 * of actions reused from the pools and created, because the pools were empty.
+	 */
+	static FECFActionsPoolStats GetActionsPoolStats(const UObject* WorldContextObject);
+
 	/**
 	 * Returns the popinter to the Action. Use it mostly for debugging purposes.
+	 * Light delays don't have action objects, so it returns nullptr for them.
 	 */
 	static UECFActionBase* GetActionFromHandle(const UObject* WorldContextObject, const FECFHandle& Handle);
 
@@ -115,6 +159,28 @@ public:
 	 */
 	static bool GetPause(const UObject* WorldContextObject);
 
+	/**
+	 * Sets if the given clock is paused or not. Actions using this clock are not ticked and their time doesn't pass.
+	 * Clocks which are not used yet are created. None means the Gameplay clock.
+	 */
+	static void SetClockPaused(const UObject* WorldContextObject, FName Clock, bool bPaused);
+
+	/**
+	 * Checks if the given clock is paused or not.
+	 */
+	static bool IsClockPaused(const UObject* WorldContextObject, FName Clock);
+
+	/**
+	 * Sets the time scale of the given clock. It scales the time of all actions using this clock.
+	 * Clocks which are not used yet are created. None means the Gameplay clock.
+	 */
+	static void SetClockTimeScale(const UObject* WorldContextObject, FName Clock, float TimeScale);
+
+	/**
+	 * Returns the time scale of the given clock.
+	 */
+	static float GetClockTimeScale(const UObject* WorldContextObject, FName Clock);
+
 	/*^^^ Stop ECF Functions ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 	/**
@@ -186,14 +252,8 @@ public:
 	 *	[]() -> void.
 	 * @param Settings [optional] - an extra settings to apply to this action.
 	 */
-	static FECFHandle AddTicker(const UObject* InOwner, TUniqueFunction<void(float/* DeltaTime*/)>&& InTickFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTicker(const UObject* InOwner, TUniqueFunction<void(float/* DeltaTime*/)>&& InTickFunc, TUniqueFunction<void()>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTicker(const UObject* InOwner, float InTickingTime, TUniqueFunction<void(float/* DeltaTime*/)>&& InTickFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTicker(const UObject* InOwner, float InTickingTime, TUniqueFunction<void(float/* DeltaTime*/)>&& InTickFunc, TUniqueFunction<void()>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTicker(const UObject* InOwner, TUniqueFunction<void(float/* DeltaTime*/, FECFHandle/* ActionHandle*/)>&& InTickFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTicker(const UObject* InOwner, TUniqueFunction<void(float/* DeltaTime*/, FECFHandle/* ActionHandle*/)>&& InTickFunc, TUniqueFunction<void()>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTicker(const UObject* InOwner, float InTickingTime, TUniqueFunction<void(float/* DeltaTime*/, FECFHandle/* ActionHandle*/)>&& InTickFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTicker(const UObject* InOwner, float InTickingTime, TUniqueFunction<void(float/* DeltaTime*/, FECFHandle/* ActionHandle*/)>&& InTickFunc, TUniqueFunction<void()>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
+	static FECFHandle AddTicker(const UObject* InOwner, TECFCallback<void(float/* DeltaTime*/, FECFHandle/* ActionHandle*/), void(float/* DeltaTime*/)>&& InTickFunc, TECFCallback<void(bool/* bStopped*/), void()>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
+	static FECFHandle AddTicker(const UObject* InOwner, float InTickingTime, TECFCallback<void(float/* DeltaTime*/, FECFHandle/* ActionHandle*/), void(float/* DeltaTime*/)>&& InTickFunc, TECFCallback<void(bool/* bStopped*/), void()>&& InCallbackFunc = nullptr, const FECFActionSettings& Settings = {});
 
 	/**
 	 * Removes all running tickers.
@@ -214,8 +274,7 @@ public:
 	 *	[]() -> void.
 	 * @param Settings [optional] - an extra settings to apply to this action.
 	 */
-	static FECFHandle Delay(const UObject* InOwner, float InDelayTime, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, const FECFActionSettings& Settings = {});
-	static FECFHandle Delay(const UObject* InOwner, float InDelayTime, TUniqueFunction<void()>&& InCallbackFunc, const FECFActionSettings& Settings = {});
+	static FECFHandle Delay(const UObject* InOwner, float InDelayTime, TECFCallback<void(bool/* bStopped*/), void()>&& InCallbackFunc, const FECFActionSettings& Settings = {});
 
 	/**
 	 * Stops all delays.
@@ -263,12 +322,7 @@ public:
 	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
 	 * @param Settings [optional]	- an extra settings to apply to this action.
 	 */
-	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/()>&& InPredicate, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
-	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/()>&& InPredicate, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
-	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/()>&& InPredicate, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
-	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/(float/* DeltaTime*/)>&& InPredicate, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
-	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/(float/* DeltaTime*/)>&& InPredicate, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
-	static FECFHandle WaitAndExecute(const UObject* InOwner, TUniqueFunction<bool/* bHasFinished*/(float/* DeltaTime*/)>&& InPredicate, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
+	static FECFHandle WaitAndExecute(const UObject* InOwner, TECFCallback<bool/* bHasFinished*/(float/* DeltaTime*/), bool/* bHasFinished*/()>&& InPredicate, TECFCallback<void(bool/* bTimedOut*/, bool/* bStopped*/), void(bool/* bTimedOut*/), void()>&& InCallbackFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
 
 
 	/**
@@ -322,8 +376,7 @@ public:
 	 * @param InBlendExp -      [optional] an exponent, used by certain blend functions (EaseIn, EaseOut, EaseInOut) to control the shape of the timeline curve.
 	 * @param Settings [optional] - an extra settings to apply to this action.
 	 */
-	static FECFHandle AddTimeline(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(float/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTimeline(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
+	static FECFHandle AddTimeline(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, TECFCallback<void(float/* Value*/, float/* Time*/)>&& InTickFunc, TECFCallback<void(float/* Value*/, float/* Time*/, bool/* bStopped*/), void(float/* Value*/, float/* Time*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
 
 	/**
 	 * Stops timelines. Will not launch callback functions.
@@ -349,8 +402,7 @@ public:
 	 * @param InBlendExp -      [optional] an exponent, used by certain blend functions (EaseIn, EaseOut, EaseInOut) to control the shape of the timeline curve.
 	 * @param Settings [optional] - an extra settings to apply to this action.
 	 */
-	static FECFHandle AddTimelineVector(const UObject* InOwner, FVector InStartValue, FVector InStopValue, float InTime, TUniqueFunction<void(FVector/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(FVector/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTimelineVector(const UObject* InOwner, FVector InStartValue, FVector InStopValue, float InTime, TUniqueFunction<void(FVector/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(FVector/* Value*/, float/* Time*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
+	static FECFHandle AddTimelineVector(const UObject* InOwner, FVector InStartValue, FVector InStopValue, float InTime, TECFCallback<void(FVector/* Value*/, float/* Time*/)>&& InTickFunc, TECFCallback<void(FVector/* Value*/, float/* Time*/, bool/* bStopped*/), void(FVector/* Value*/, float/* Time*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
 
 	[[deprecated("Function deprecated. Use StopAllActionsOfClass<UECFTimelineVector> instead.")]]
 	static void RemoveAllTimelinesVector(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
@@ -370,8 +422,7 @@ public:
 	 * @param InBlendExp -      [optional] an exponent, used by certain blend functions (EaseIn, EaseOut, EaseInOut) to control the shape of the timeline curve.
 	 * @param Settings [optional] - an extra settings to apply to this action.
 	 */
-	static FECFHandle AddTimelineLinearColor(const UObject* InOwner, FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TUniqueFunction<void(FLinearColor/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(FLinearColor/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
-	static FECFHandle AddTimelineLinearColor(const UObject* InOwner, FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TUniqueFunction<void(FLinearColor/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(FLinearColor/* Value*/, float/* Time*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
+	static FECFHandle AddTimelineLinearColor(const UObject* InOwner, FLinearColor InStartValue, FLinearColor InStopValue, float InTime, TECFCallback<void(FLinearColor/* Value*/, float/* Time*/)>&& InTickFunc, TECFCallback<void(FLinearColor/* Value*/, float/* Time*/, bool/* bStopped*/), void(FLinearColor/* Value*/, float/* Time*/)>&& InCallbackFunc = nullptr, EECFBlendFunc InBlendFunc = EECFBlendFunc::ECFBlend_Linear, float InBlendExp = 1.f, const FECFActionSettings& Settings = {});
 
 	[[deprecated("Function deprecated. Use StopAllActionsOfClass<UECFTimelineLinearColor> instead.")]]
 	static void RemoveAllTimelinesLinearColor(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
@@ -518,23 +569,136 @@ public:
 	[[deprecated("Function deprecated. Use StopAllActionsOfClass<UECFDoNoMoreThanXTime> instead.")]]
 	static void RemoveAllDoNoMoreThanXTimes(const UObject* WorldContextObject, UObject* InOwner = nullptr);
 
+	/*^^^ Gate ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Run this code of block only when the gate of this instance is open.
+	 * The gate can be opened and closed with OpenGate, CloseGate and ToggleGate. Resetting the gate restores its initial state.
+	 * @param InExecFunc - the function to execute.
+	 * @param InstanceId - the id of the instance of this action.
+	 * @param bStartClosed - if true, the gate will be closed when it is created.
+	 */
+	static FECFHandle Gate(const UObject* InOwner, TUniqueFunction<void()>&& InExecFunc, const FECFInstanceId& InstanceId, bool bStartClosed = false);
+
+	/**
+	 * Opens the gate of the given instance.
+	 * @param InstanceId - the id of the instance of the gate.
+	 */
+	static void OpenGate(const UObject* WorldContextObject, const FECFInstanceId& InstanceId);
+
+	/**
+	 * Closes the gate of the given instance.
+	 * @param InstanceId - the id of the instance of the gate.
+	 */
+	static void CloseGate(const UObject* WorldContextObject, const FECFInstanceId& InstanceId);
+
+	/**
+	 * Opens the closed gate or closes the opened gate of the given instance.
+	 * @param InstanceId - the id of the instance of the gate.
+	 */
+	static void ToggleGate(const UObject* WorldContextObject, const FECFInstanceId& InstanceId);
+
+	/*^^^ Flip Flop ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Run this code of block alternately as A and B per instance, starting with A.
+	 * Resetting the flip flop makes the next run A again.
+	 * @param InExecFunc - the function to execute. The function gets true when it is run as A and false when it is run as B.
+	 * @param InstanceId - the id of the instance of this action.
+	 */
+	static FECFHandle FlipFlop(const UObject* InOwner, TUniqueFunction<void(bool/* bIsA*/)>&& InExecFunc, const FECFInstanceId& InstanceId);
+
+	/*^^^ Latch ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Run this code of block once, when it has been called the given number of times per instance.
+	 * Further calls are ignored until the latch is reset.
+	 * @param InCount - how many calls are required to run the code (must be at least 1).
+	 * @param InExecFunc - the function to execute.
+	 * @param InstanceId - the id of the instance of this action.
+	 */
+	static FECFHandle Latch(const UObject* InOwner, const uint32 InCount, TUniqueFunction<void()>&& InExecFunc, const FECFInstanceId& InstanceId);
+
 	/*^^^ Run Async Then ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 	/**
 	 * Runs the given task function on a separate thread and calls the callback function when this task ends.
-	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread. Must be: []() -> void.
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread.
+	 *	Can be: [](const FECFCancellationToken& CancellationToken) -> void.
+	 *	Can be: []() -> void.
 	 * @param InCallbackFunc		- a callback with action to execute when the async task ends. Will return bool indicating if the callback was called because of the timeout. 
 	 *	Can be: [](bool bTimedOut, bool bStopped) -> void.
 	 *	Can be: [](bool bTimedOut) -> void.
 	 *	Can be: []() -> void.
 	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
-	 *								  Have in mind, that the timeout will not stop the running async thread, it just won't trigger callback when the async task ends. Handle timeout on the side of the async task itself.
-	 * @param InThreadPriority		- thread priority (can be Normal or HiPriority).
+	 *								  Have in mind, that the timeout will not kill the running async task. It cancels the token passed to the task, so the task can end early.
+	 *								  The token is also canceled when the action is stopped or its owner is destroyed.
+	 * @param InThreadPriority		- thread priority (Normal, HiPriority or LowPriority background thread, or Foreground thread).
 	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 * @param InPipe [optional]		- if set, the task runs in this pipe. Tasks in the same pipe run in order and never concurrently,
+	 *								  so long tasks of one system don't occupy many worker threads at once. Can be a name, e.g. TEXT("Saves"),
+	 *								  or FECFAsyncPipe::PerOwner(TEXT("Saves")) for a separate pipe for every owner.
+	 */
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {});
+
+	/**
+	 * Runs the given task function returning a result on a separate thread and passes the result to the callback function when this task ends.
+	 * The result is moved from the task to the callback, so it is never copied. It can be a move-only type without a default constructor.
+	 * Usage: FFlow::RunAsyncThen<FMyResult>(this, [](const FECFCancellationToken& Token) { return FMyResult(...); }, [](TOptional<FMyResult>&& Result, bool bTimedOut, bool bStopped) {...});
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread.
+	 *	Can be: [](const FECFCancellationToken& CancellationToken) -> T.
+	 *	Can be: []() -> T.
+	 * @param InCallbackFunc		- a callback receiving the result when the async task ends. The result is unset if the task hasn't ended, e.g. because of the timeout.
+	 *	Must be: [](TOptional<T>&& Result, bool bTimedOut, bool bStopped) -> void.
+	 * Other params are the same as in the regular RunAsyncThen.
 	 */
-	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
-	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
-	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	template<typename T>
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<T(const FECFCancellationToken&)>&& InAsyncTaskFunc, TUniqueFunction<void(TOptional<T>&&/* Result*/, bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {})
+	{
+		TECFAsyncResultTask<T> AsyncTask;
+		AsyncTask.FuncWithToken = MoveTemp(InAsyncTaskFunc);
+		AsyncTask.Callback = MoveTemp(InCallbackFunc);
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+			return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(AsyncTask), InTimeOut, InThreadPriority, InPipe);
+		else
+			return FECFHandle();
+	}
+
+	template<typename T>
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<T()>&& InAsyncTaskFunc, TUniqueFunction<void(TOptional<T>&&/* Result*/, bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {})
+	{
+		TECFAsyncResultTask<T> AsyncTask;
+		AsyncTask.Func = MoveTemp(InAsyncTaskFunc);
+		AsyncTask.Callback = MoveTemp(InCallbackFunc);
+		if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+			return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(AsyncTask), InTimeOut, InThreadPriority, InPipe);
+		else
+			return FECFHandle();
+	}
+
+	/**
+	 * Runs the stages of the given pipeline on separate threads and calls the callback function when all stages end.
+	 * Every stage is launched as soon as its prerequisites end, without waiting for the ECF tick, so only the callback
+	 * is called on the Game Thread. The whole pipeline is one Run Async Then action with one handle, which can be stopped
+	 * or checked like any other action.
+	 * @param InPipeline			- the pipeline built with Add, Then, WhenAll and WhenAny.
+	 * @param InCallbackFunc		- a callback with action to execute when all stages end.
+	 *	Can be: [](bool bTimedOut, bool bStopped) -> void.
+	 *	Can be: [](bool bTimedOut) -> void.
+	 *	Can be: []() -> void.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
+	 *								  The token passed to the stages is canceled and the stages that haven't started yet are skipped.
+	 * @param InThreadPriority		- thread priority of all stages.
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	static FECFHandle RunAsyncPipeline(const UObject* InOwner, FECFAsyncPipeline&& InPipeline, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncPipeline(const UObject* InOwner, FECFAsyncPipeline&& InPipeline, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncPipeline(const UObject* InOwner, FECFAsyncPipeline&& InPipeline, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
 
 	/**
 	 * Stops Run Async Thens. Have in mind it will not stop running async threads. 
@@ -625,13 +789,42 @@ public:
 	/*^^^ Run Async And Wait (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 	
 	/**
-	 * Suspends running coroutine function until the given predicate won't return true.
-	 * @param InPredicate			- a function that decides if the suspended function should be resumed.
-	 *								  If it returns true it means the suspended function must be resumed. Must be: [](float DeltaTime) -> bool
-	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this timeout the suspended function will be resumed.
+	 * Runs the given task function on a separate thread and suspends running coroutine function until this task ends.
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread.
+	 *	Can be: [](const FECFCancellationToken& CancellationToken) -> void.
+	 *	Can be: []() -> void.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this timeout the suspended function will be resumed
+	 *								  and the token passed to the task will be canceled.
+	 * @param InThreadPriority		- thread priority (Normal, HiPriority or LowPriority background thread, or Foreground thread).
 	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 * @param InPipe [optional]		- if set, the task runs in this pipe. Tasks in the same pipe run in order and never concurrently.
+	 *								  Can be a name or FECFAsyncPipe::PerOwner.
 	 */
-	static FECFCoroutineAwaiter_RunAsyncAndWait RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFCoroutineAwaiter_RunAsyncAndWait RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {});
+	static FECFCoroutineAwaiter_RunAsyncAndWait RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {});
+
+	/**
+	 * Runs the given task function returning a result on a separate thread and suspends running coroutine function until this task ends.
+	 * The result is moved from the task to the co_await expression, so it is never copied. It can be a move-only type without a default constructor.
+	 * Usage: auto [Result, bStopped, bTimedOut] = co_await FFlow::RunAsyncAndWait<FMyResult>(this, []() { return FMyResult(...); });
+	 * The Result is TOptional<T>, unset if the task hasn't ended, e.g. because of the timeout.
+	 * Params are the same as in the regular RunAsyncAndWait.
+	 */
+	template<typename T>
+	static TECFCoroutineAwaiter_RunAsyncAndWait<T> RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<T(const FECFCancellationToken&)>&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {})
+	{
+		TECFAsyncResultTask<T> AsyncTask;
+		AsyncTask.FuncWithToken = MoveTemp(InAsyncTaskFunc);
+		return TECFCoroutineAwaiter_RunAsyncAndWait<T>(InOwner, Settings, MoveTemp(AsyncTask), InTimeOut, InThreadPriority, InPipe);
+	}
+
+	template<typename T>
+	static TECFCoroutineAwaiter_RunAsyncAndWait<T> RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<T()>&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {}, const FECFAsyncPipe& InPipe = {})
+	{
+		TECFAsyncResultTask<T> AsyncTask;
+		AsyncTask.Func = MoveTemp(InAsyncTaskFunc);
+		return TECFCoroutineAwaiter_RunAsyncAndWait<T>(InOwner, Settings, MoveTemp(AsyncTask), InTimeOut, InThreadPriority, InPipe);
+	}
 
 	/**
 	 * Stops all Wait Until coroutine actions.